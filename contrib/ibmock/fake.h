@@ -57,6 +57,7 @@ struct fake_cqe {
     struct list    list;
     struct ibv_wc  wc;
     struct fake_cq *fcq; /* owner CQ */
+    uint64_t       time; /* Time when the completion was generated, usec */
     void (*free)(void*);
 };
 
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <unistd.h>
+#include <time.h>
 
 #define NUM_DEVS   2
 #define SYS_PATH   "/tmp/ibmock"
@@ -33,6 +34,36 @@ void unlock(void)
 
 bool verbs_allow_disassociate_destroy = 0;
 
+/* Completions become visible only after this delay, to emulate network
+ * latency. Set by IBMOCK_CQ_DELAY_US environment variable. */
+static long cq_delay_us = -1;
+
+static uint64_t dev_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000ul) + (ts.tv_nsec / 1000);
+}
+
+static long dev_cq_delay(void)
+{
+    const char *env;
+
+    if (cq_delay_us < 0) {
+        env         = getenv("IBMOCK_CQ_DELAY_US");
+        cq_delay_us = (env != NULL) ? atol(env) : 0;
+    }
+
+    return cq_delay_us;
+}
+
+static void dev_cq_push(struct fake_cq *fcq, struct fake_cqe *fcqe)
+{
+    fcqe->time = dev_cq_delay() ? dev_time_us() : 0;
+    list_add_tail(&fcq->wcs, &fcqe->list);
+}
+
 enum be_mode {
     BE_NOTSET,
     BE_LOOPBACK
@@ -243,7 +274,7 @@ rx_send(struct fake_qp *fqp, struct fake_hdr *hdr, struct iovec *iov, int count)
     recv->fcqe.free        = fake_recv_wr_free;
 
     fcq = (struct fake_cq*)fqp->qp_ex.qp_base.recv_cq;
-    list_add_tail(&fcq->wcs, &recv->fcqe.list);
+    dev_cq_push(fcq, &recv->fcqe);
     return 1;
 }
 
@@ -356,7 +387,7 @@ static void dev_send_comp(void *arg, int ret)
         fcqe->wc.status = IBV_WC_GENERAL_ERR;
     }
 
-    list_add_tail(&fcqe->fcq->wcs, &fcqe->list);
+    dev_cq_push(fcqe->fcq, fcqe);
 }
 
 static int dev_wr_send_serialize(struct ibv_qp *qp, struct ibv_send_wr *wr,
@@ -509,6 +540,8 @@ fail:
 static int dev_poll_cq(struct ibv_cq *cq, int num_entries, struct ibv_wc *wc)
 {
     struct fake_cq *fcq = (struct fake_cq*)cq;
+    long delay          = dev_cq_delay();
+    uint64_t now        = delay ? dev_time_us() : 0;
     struct fake_cqe *fcqe;
     int i;
 
@@ -519,6 +552,10 @@ static int dev_poll_cq(struct ibv_cq *cq, int num_entries, struct ibv_wc *wc)
         }
 
         fcqe = (struct fake_cqe*)list_first(&fcq->wcs);
+        if (fcqe->time + delay > now) {
+            break;
+        }
+
         list_del(&fcqe->list);
         wc[i] = fcqe->wc;
         fcqe->free(fcqe);
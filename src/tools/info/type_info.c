@@ -265,6 +265,8 @@ void print_type_info(const char * tl_name)
     PRINT_SIZE(ucp_worker_t);
     PRINT_SIZE(ucp_ep_t);
     PRINT_SIZE(ucp_ep_ext_t);
+    PRINT_SIZE(ucp_ep_ext_stream_t);
+    PRINT_SIZE(ucp_ep_ext_am_t);
     PRINT_SIZE(ucp_ep_config_key_t);
     PRINT_SIZE(ucp_ep_config_t);
     PRINT_SIZE(ucp_datatype_iter_t);
@@ -216,6 +216,8 @@ typedef struct ucm_global_config {
     uint64_t             cuda_hook_modes;             /* Bitmap of allowed cuda hooks modes */
     int                  enable_dynamic_mmap_thresh;  /* Enable adaptive mmap threshold */
     size_t               alloc_alignment;             /* Alignment for memory allocations */
+    unsigned             malloc_arenas;               /* Maximal number of per-thread arenas */
+    size_t               malloc_arena_size;           /* Size of a per-thread arena */
     int                  dlopen_process_rpath;        /* Process RPATH section in dlopen hook */
     int                  module_unload_prevent_mode;  /* Module unload prevention mode */
     int                  bistro_force_far_jump;       /* Force far jump with bistro patching */
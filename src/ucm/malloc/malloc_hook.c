@@ -27,6 +27,8 @@
 #include <ucm/util/reloc.h>
 #include <ucm/util/khash_safe.h>
 #include <ucm/util/sys.h>
+#include <ucs/arch/atomic.h>
+#include <ucs/arch/cpu.h>
 #include <ucs/datastruct/queue.h>
 #include <ucs/sys/compiler.h>
 #include <ucs/sys/math.h>
@@ -55,6 +57,13 @@
 /* Maximal size for mmap threshold - 32mb */
 #define UCM_DEFAULT_MMAP_THRESHOLD_MAX (4ul * 1024 * 1024 * sizeof(long))
 
+/* Maximal number of per-thread arenas */
+#define UCM_MALLOC_ARENAS_MAX          256
+
+/* Larger blocks are allocated from the global heap, so they are released by
+ * munmap() and generate memory events like before */
+#define UCM_MALLOC_ARENA_MAX_ALLOC     (128ul * 1024)
+
 KHASH_MAP_INIT_INT64(mmap_pages, size_t);
 
 /* Pointer to memory release function */
@@ -64,6 +73,22 @@ typedef void (*ucm_release_func_t)(void *ptr);
 typedef size_t (*ucm_usable_size_func_t)(void *ptr);
 
 
+/*
+ * Per-thread arena: a fixed memory range managed by a private, unlocked,
+ * mspace. Only the owner thread allocates and releases blocks in the mspace;
+ * other threads push the blocks they release to a lock-free list, which the
+ * owner drains on its next allocation.
+ */
+typedef struct ucm_malloc_arena {
+    void                     *start;      /* Start of arena memory */
+    void                     *end;        /* End of arena memory */
+    mspace                   msp;         /* Allocator of arena memory */
+    volatile uint64_t        remote_free; /* List of blocks released by other
+                                             threads */
+    int                      owned;       /* Whether a thread uses the arena */
+} ucm_malloc_arena_t;
+
+
 typedef struct ucm_malloc_hook_state {
     /*
      * State of hook installment
@@ -100,6 +125,18 @@ typedef struct ucm_malloc_hook_state {
      */
     khash_t(mmap_pages)      mmap_pages;
 
+    /*
+     * Per-thread arenas
+     */
+    ucs_spinlock_t           arena_lock; /* Protect arenas creation and
+                                            ownership */
+    pthread_key_t            arena_key; /* Releases the arena on thread exit */
+    int                      arena_key_valid; /* Whether arena_key was created */
+    /* Number of created arenas; arenas are never destroyed, so a pointer may
+     * be looked up without holding the lock */
+    volatile unsigned        num_arenas;
+    ucm_malloc_arena_t       arenas[UCM_MALLOC_ARENAS_MAX];
+
     /**
      * Save the environment strings we've allocated
      */
@@ -122,11 +159,22 @@ static ucm_malloc_hook_state_t ucm_malloc_hook_state = {
     .heap_start       = (void*)-1,
     .heap_end         = (void*)-1,
     .mmap_pages       = KHASH_STATIC_INITIALIZER,
+    .arena_key_valid  = 0,
+    .num_arenas       = 0,
     .env_lock         = PTHREAD_MUTEX_INITIALIZER,
     .env_strs         = NULL,
     .num_env_strs     = 0
 };
 
+/* Arena of the current thread */
+static __thread ucm_malloc_arena_t *ucm_malloc_arena_current
+        __attribute__((tls_model("initial-exec"))) = NULL;
+
+/* Set if the current thread should not use an arena: it has exited, or there
+ * was no free arena for it */
+static __thread int ucm_malloc_arena_disabled
+        __attribute__((tls_model("initial-exec"))) = 0;
+
 int ucm_dlmallopt_get(int); /* implemented in ptmalloc */
 
 static int64_t ucm_malloc_page_address(void *ptr)
@@ -236,11 +284,195 @@ static void ucm_release_foreign_block(void *ptr, ucm_release_func_t orig_free,
     }
 }
 
+static ucm_malloc_arena_t *ucm_malloc_arena_find(void *ptr)
+{
+    unsigned i, num_arenas = ucm_malloc_hook_state.num_arenas;
+    ucm_malloc_arena_t *arena;
+
+    for (i = 0; i < num_arenas; ++i) {
+        arena = &ucm_malloc_hook_state.arenas[i];
+        if ((ptr >= arena->start) && (ptr < arena->end)) {
+            return arena;
+        }
+    }
+
+    return NULL;
+}
+
+static void ucm_malloc_arena_drain(ucm_malloc_arena_t *arena)
+{
+    void *ptr, *next;
+
+    if (ucs_likely(arena->remote_free == 0)) {
+        return;
+    }
+
+    ptr = (void*)(uintptr_t)ucs_atomic_swap64(&arena->remote_free, 0);
+    while (ptr != NULL) {
+        next = *(void**)ptr;
+        ucm_dlmspace_free(arena->msp, ptr);
+        ptr  = next;
+    }
+}
+
+static void ucm_malloc_arena_free(ucm_malloc_arena_t *arena, void *ptr)
+{
+    uint64_t head;
+
+    if (arena == ucm_malloc_arena_current) {
+        ucm_dlmspace_free(arena->msp, ptr);
+        return;
+    }
+
+    /* Released by another thread, or after the owner has exited */
+    do {
+        head         = arena->remote_free;
+        *(void**)ptr = (void*)(uintptr_t)head;
+    } while (!ucs_atomic_bool_cswap64(&arena->remote_free, head,
+                                      (uintptr_t)ptr));
+}
+
+static void ucm_malloc_arena_release(void *arg)
+{
+    ucm_malloc_arena_t *arena = arg;
+
+    ucm_malloc_arena_drain(arena);
+
+    /* Blocks released from now on by this thread are queued to the arena */
+    ucm_malloc_arena_current  = NULL;
+    ucm_malloc_arena_disabled = 1;
+
+    ucs_spin_lock(&ucm_malloc_hook_state.arena_lock);
+    arena->owned = 0;
+    ucs_spin_unlock(&ucm_malloc_hook_state.arena_lock);
+}
+
+static ucm_malloc_arena_t *ucm_malloc_arena_acquire()
+{
+    size_t size = ucs_align_up_pow2(ucm_global_opts.malloc_arena_size,
+                                    ucm_get_page_size());
+    unsigned max_arenas = ucs_min(ucm_global_opts.malloc_arenas,
+                                  UCM_MALLOC_ARENAS_MAX);
+    ucm_malloc_arena_t *arena;
+    unsigned i;
+    void *ptr;
+
+    ucs_spin_lock(&ucm_malloc_hook_state.arena_lock);
+
+    /* Reuse an arena released by an exited thread */
+    for (i = 0; i < ucm_malloc_hook_state.num_arenas; ++i) {
+        arena = &ucm_malloc_hook_state.arenas[i];
+        if (!arena->owned) {
+            goto out_owned;
+        }
+    }
+
+    if (ucm_malloc_hook_state.num_arenas >= max_arenas) {
+        arena = NULL;
+        goto out_unlock;
+    }
+
+    /* Not using mmap() hooks, since the arena is never unmapped, and since
+     * memory event handlers could allocate memory */
+    ptr = ucm_orig_mmap(NULL, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (ptr == MAP_FAILED) {
+        ucm_debug("failed to map malloc arena of %zu bytes: %m", size);
+        arena = NULL;
+        goto out_unlock;
+    }
+
+    arena              = &ucm_malloc_hook_state.arenas[i];
+    arena->start       = ptr;
+    arena->end         = UCS_PTR_BYTE_OFFSET(ptr, size);
+    arena->remote_free = 0;
+    arena->msp         = ucm_dlcreate_mspace_with_base(ptr, size, 0);
+    /* Do not let the arena grow beyond its memory range */
+    ucm_dlmspace_set_footprint_limit(arena->msp, size);
+
+    ucs_memory_cpu_store_fence();
+    ++ucm_malloc_hook_state.num_arenas;
+    ucm_debug("created malloc arena %u at [%p..%p]", i, arena->start,
+              arena->end);
+
+out_owned:
+    arena->owned = 1;
+out_unlock:
+    ucs_spin_unlock(&ucm_malloc_hook_state.arena_lock);
+    return arena;
+}
+
+static ucm_malloc_arena_t *ucm_malloc_arena_get()
+{
+    ucm_malloc_arena_t *arena = ucm_malloc_arena_current;
+
+    if (ucm_global_opts.malloc_arenas == 0) {
+        return NULL;
+    }
+
+    if (ucs_likely(arena != NULL)) {
+        ucm_malloc_arena_drain(arena);
+        return arena;
+    }
+
+    if (ucm_malloc_arena_disabled || !ucm_malloc_hook_state.arena_key_valid ||
+        RUNNING_ON_VALGRIND) {
+        return NULL;
+    }
+
+    arena = ucm_malloc_arena_acquire();
+    if (arena == NULL) {
+        ucm_malloc_arena_disabled = 1;
+        return NULL;
+    }
+
+    ucm_malloc_arena_current = arena;
+    pthread_setspecific(ucm_malloc_hook_state.arena_key, arena);
+    ucm_malloc_arena_drain(arena);
+    return arena;
+}
+
+static void *ucm_malloc_arena_alloc(size_t alignment, size_t size)
+{
+    int saved_errno = errno;
+    ucm_malloc_arena_t *arena;
+    void *ptr;
+
+    if (size > UCM_MALLOC_ARENA_MAX_ALLOC) {
+        return NULL;
+    }
+
+    arena = ucm_malloc_arena_get();
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    if (alignment > 1) {
+        ptr = ucm_dlmspace_memalign(arena->msp, alignment, size);
+    } else {
+        ptr = ucm_dlmspace_malloc(arena->msp, size);
+    }
+
+    if (ptr == NULL) {
+        /* Arena is full, the block would be allocated from the global heap */
+        errno = saved_errno;
+    }
+
+    return ptr;
+}
+
 static void *ucm_malloc_impl(size_t size, const char *debug_name)
 {
     void *ptr;
 
     ucm_malloc_hook_state.hook_called = 1;
+
+    ptr = ucm_malloc_arena_alloc(ucm_global_opts.alloc_alignment, size);
+    if (ptr != NULL) {
+        ucm_trace("%s(size=%zu)=%p, in arena", debug_name, size, ptr);
+        return ptr;
+    }
+
     if (ucm_global_opts.alloc_alignment > 1) {
         ptr = ucm_dlmemalign(ucm_global_opts.alloc_alignment, size);
     } else {
@@ -290,10 +522,14 @@ static inline void ucm_mem_free(void *ptr, size_t size)
 static void ucm_free_impl(void *ptr, ucm_release_func_t orig_free,
                           const char *debug_name)
 {
+    ucm_malloc_arena_t *arena;
+
     ucm_malloc_hook_state.hook_called = 1;
 
     if (ptr == NULL) {
         /* Ignore */
+    } else if ((arena = ucm_malloc_arena_find(ptr)) != NULL) {
+        ucm_malloc_arena_free(arena, ptr);
     } else if (ucm_malloc_address_remove_if_managed(ptr, debug_name)) {
         ucm_mem_free(ptr, ucm_dlmalloc_usable_size(ptr));
     } else {
@@ -306,7 +542,15 @@ static void *ucm_memalign_impl(size_t alignment, size_t size, const char *debug_
     void *ptr;
 
     ucm_malloc_hook_state.hook_called = 1;
-    ptr = ucm_dlmemalign(ucs_max(alignment, ucm_global_opts.alloc_alignment), size);
+    alignment = ucs_max(alignment, ucm_global_opts.alloc_alignment);
+
+    ptr = ucm_malloc_arena_alloc(alignment, size);
+    if (ptr != NULL) {
+        ucm_trace("%s(size=%zu)=%p, in arena", debug_name, size, ptr);
+        return ptr;
+    }
+
+    ptr = ucm_dlmemalign(alignment, size);
     ucm_malloc_allocated(ptr, size, debug_name);
     return ptr;
 }
@@ -322,13 +566,43 @@ static size_t ucm_malloc_usable_size_common(void *mem, int foreign)
                      dlmalloc_usable_size(mem);
 }
 
+static void *ucm_malloc_arena_realloc(ucm_malloc_arena_t *arena, void *oldptr,
+                                      size_t size)
+{
+    void *newptr;
+
+    if ((arena == ucm_malloc_arena_current) &&
+        (size <= UCM_MALLOC_ARENA_MAX_ALLOC)) {
+        newptr = ucm_dlmspace_realloc(arena->msp, oldptr, size);
+        if (newptr != NULL) {
+            return newptr;
+        }
+    }
+
+    /* Move the block to the current thread's arena or to the global heap */
+    newptr = ucm_malloc_impl(size, "realloc");
+    if (newptr == NULL) {
+        return NULL;
+    }
+
+    memcpy(newptr, oldptr, ucs_min(size, dlmalloc_usable_size(oldptr)));
+    ucm_malloc_arena_free(arena, oldptr);
+    return newptr;
+}
+
 static void *ucm_realloc(void *oldptr, size_t size, const void *caller)
 {
+    ucm_malloc_arena_t *arena;
     void *newptr;
     size_t oldsz;
     int foreign;
 
     ucm_malloc_hook_state.hook_called = 1;
+    if ((oldptr != NULL) &&
+        ((arena = ucm_malloc_arena_find(oldptr)) != NULL)) {
+        return ucm_malloc_arena_realloc(arena, oldptr, size);
+    }
+
     if (oldptr != NULL) {
         foreign = !ucm_malloc_address_remove_if_managed(oldptr, "realloc");
         if (RUNNING_ON_VALGRIND || foreign) {
@@ -722,7 +996,8 @@ static int ucm_malloc_mallopt(int param_number, int value)
 static size_t ucm_malloc_usable_size(void *mem)
 {
     return ucm_malloc_usable_size_common(mem,
-                                         !ucm_malloc_is_address_in_heap(mem));
+                                         !ucm_malloc_is_address_in_heap(mem) &&
+                                         (ucm_malloc_arena_find(mem) == NULL));
 }
 
 static char *ucm_malloc_blacklist[] = {
@@ -917,4 +1192,8 @@ void ucm_malloc_state_reset(int default_mmap_thresh, int default_trim_thresh)
 void ucm_init_malloc_hook()
 {
     ucs_recursive_spinlock_init(&ucm_malloc_hook_state.lock, 0);
+    ucs_spinlock_init(&ucm_malloc_hook_state.arena_lock, 0);
+    ucm_malloc_hook_state.arena_key_valid =
+            (pthread_key_create(&ucm_malloc_hook_state.arena_key,
+                                ucm_malloc_arena_release) == 0);
 }
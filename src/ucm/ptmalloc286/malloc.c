@@ -845,6 +845,29 @@ extern "C" {
 #define dlindependent_comalloc       UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, independent_comalloc)
 #define dlbulk_free                  UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, bulk_free)
 #define dlmallopt_get                UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mallopt_get)
+#define create_mspace                UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, create_mspace)
+#define destroy_mspace               UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, destroy_mspace)
+#define create_mspace_with_base      UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, create_mspace_with_base)
+#define mspace_track_large_chunks    UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_track_large_chunks)
+#define mspace_mallinfo              UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_mallinfo)
+#define mspace_malloc                UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_malloc)
+#define mspace_free                  UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_free)
+#define mspace_calloc                UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_calloc)
+#define mspace_realloc               UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_realloc)
+#define mspace_realloc_in_place      UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_realloc_in_place)
+#define mspace_memalign              UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_memalign)
+#define mspace_independent_calloc    UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_independent_calloc)
+#define mspace_independent_comalloc  UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_independent_comalloc)
+#define mspace_bulk_free             UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_bulk_free)
+#define mspace_usable_size           UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_usable_size)
+#define mspace_malloc_stats          UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_malloc_stats)
+#define mspace_trim                  UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_trim)
+#define mspace_footprint             UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_footprint)
+#define mspace_max_footprint         UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_max_footprint)
+#define mspace_footprint_limit       UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_footprint_limit)
+#define mspace_set_footprint_limit   UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_set_footprint_limit)
+#define mspace_inspect_all           UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_inspect_all)
+#define mspace_mallopt               UCS_PP_TOKENPASTE(UCM_MALLOC_PREFIX, mspace_mallopt)
 #endif /* UCM_MALLOC_PREFIX */
 
 /*
@@ -47,6 +47,8 @@ ucm_global_config_t ucm_global_opts = {
                                   UCS_BIT(UCM_MMAP_HOOK_RELOC),
     .enable_dynamic_mmap_thresh = 1,
     .alloc_alignment            = 16,
+    .malloc_arenas              = 0,
+    .malloc_arena_size          = 64 * UCS_MBYTE,
     .dlopen_process_rpath       = 1,
     .bistro_force_far_jump      = 0,
 };
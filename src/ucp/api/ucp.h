@@ -244,7 +244,18 @@ typedef enum {
     /**< Pack addresses of network devices only. Using such shortened addresses
      *   for the remote node peers will reduce the amount of wireup data being
      *   exchanged during connection establishment phase. */
-    UCP_WORKER_ADDRESS_FLAG_NET_ONLY = UCS_BIT(0)
+    UCP_WORKER_ADDRESS_FLAG_NET_ONLY = UCS_BIT(0),
+
+    /**< Pack a compact address, which contains only the worker unique id and
+     *   transport interface addresses. Device addresses and transport
+     *   attributes are replaced by a reference to the address dictionary of
+     *   the worker, see @ref UCP_WORKER_ATTR_FIELD_ADDRESS_DICT. The
+     *   dictionary must be imported by @ref ucp_worker_address_dict_import
+     *   "ucp_worker_address_dict_import()" on the remote worker before the
+     *   compact address is passed to @ref ucp_ep_create "ucp_ep_create()".
+     *   Workers with the same configuration on the same host have the same
+     *   dictionary, so it is enough to exchange it once per host. */
+    UCP_WORKER_ADDRESS_FLAG_COMPACT  = UCS_BIT(1)
 } ucp_worker_address_flags_t;
 
 
@@ -456,8 +467,10 @@ enum ucp_worker_attr_field {
     UCP_WORKER_ATTR_FIELD_MAX_AM_HEADER   = UCS_BIT(3), /**< Maximum header size
                                                              used by UCP AM API */
     UCP_WORKER_ATTR_FIELD_NAME            = UCS_BIT(4), /**< UCP worker name */
-    UCP_WORKER_ATTR_FIELD_MAX_INFO_STRING = UCS_BIT(5)  /**< Maximum size of
+    UCP_WORKER_ATTR_FIELD_MAX_INFO_STRING = UCS_BIT(5), /**< Maximum size of
                                                              info string */
+    UCP_WORKER_ATTR_FIELD_ADDRESS_DICT    = UCS_BIT(6)  /**< UCP address
+                                                             dictionary */
 };
 
 
@@ -796,7 +809,20 @@ typedef enum {
      * data by calling @ref ucp_am_recv_data_nbx routine. This flag is mutually
      * exclusive with @a UCP_AM_RECV_ATTR_FLAG_DATA.
      */
-    UCP_AM_RECV_ATTR_FLAG_RNDV         = UCS_BIT(17)
+    UCP_AM_RECV_ATTR_FLAG_RNDV         = UCS_BIT(17),
+
+    /**
+     * Indicates that the data was placed into a buffer obtained from the
+     * receive pool registered with @ref ucp_am_handler_param_t.recv_pool.
+     * If UCS_INPROGRESS is returned from the callback, the application takes
+     * ownership of the buffer and is responsible for returning it to its pool.
+     * Otherwise, UCP returns the buffer to the pool by calling
+     * @ref ucp_am_recv_pool_t.put. The data must not be passed to
+     * @ref ucp_am_data_release or @ref ucp_am_recv_data_nbx. This flag is
+     * mutually exclusive with @a UCP_AM_RECV_ATTR_FLAG_DATA and
+     * @a UCP_AM_RECV_ATTR_FLAG_RNDV.
+     */
+    UCP_AM_RECV_ATTR_FLAG_POOL         = UCS_BIT(18)
 } ucp_am_recv_attr_t;
 
 
@@ -823,7 +849,11 @@ enum ucp_am_handler_param_field {
     /**
      * Indicates that @ref ucp_am_handler_param_t.arg field is valid.
      */
-    UCP_AM_HANDLER_PARAM_FIELD_ARG     = UCS_BIT(3)
+    UCP_AM_HANDLER_PARAM_FIELD_ARG     = UCS_BIT(3),
+    /**
+     * Indicates that @ref ucp_am_handler_param_t.recv_pool field is valid.
+     */
+    UCP_AM_HANDLER_PARAM_FIELD_RECV_POOL = UCS_BIT(4)
 };
 
 
@@ -1288,6 +1318,21 @@ typedef struct ucp_worker_attr {
      * Maximum debug string size that can be filled with @ref ucp_request_query.
      */
     size_t                max_debug_string;
+
+    /**
+     * Address dictionary, which is referenced by compact worker addresses
+     * packed with @ref UCP_WORKER_ADDRESS_FLAG_COMPACT and the same
+     * @ref ucp_worker_attr_t::address_flags. The memory is allocated by
+     * @ref ucp_worker_query "ucp_worker_query()" routine, and must be released
+     * by using @ref ucp_worker_release_address "ucp_worker_release_address()"
+     * routine.
+     */
+    ucp_address_t         *address_dict;
+
+    /**
+     * Size of address dictionary in bytes.
+     */
+    size_t                address_dict_length;
 } ucp_worker_attr_t;
 
 
@@ -1886,6 +1931,46 @@ typedef struct {
 } ucp_request_attr_t;
 
 
+/**
+ * @ingroup UCP_WORKER
+ * @brief Application-owned receive buffer pool for Active Messages.
+ *
+ * The pool is used by UCP to place eager Active Message payloads directly into
+ * application buffers. Multi-fragment messages are assembled in the buffer as
+ * the fragments arrive, and transport receive descriptors are released right
+ * after their data is copied. The buffer is passed to
+ * @ref ucp_am_recv_callback_t with @ref UCP_AM_RECV_ATTR_FLAG_POOL flag set.
+ * Rendezvous messages are not affected by the pool.
+ */
+typedef struct ucp_am_recv_pool {
+    /**
+     * Get a buffer of at least @a length bytes from the pool. The routine may
+     * return NULL if no buffer is available, in which case UCP falls back to
+     * its internal buffers for this message.
+     * The routine is called from the context of @ref ucp_worker_progress.
+     */
+    void                     *(*get)(void *arg, size_t length);
+
+    /**
+     * Return a buffer, which was obtained by @a get routine, to the pool.
+     * Called when the Active Message callback did not retain the buffer or
+     * when the message could not be completed.
+     */
+    void                     (*put)(void *arg, void *buffer);
+
+    /**
+     * User argument passed to @a get and @a put routines.
+     */
+    void                     *arg;
+
+    /**
+     * Messages with payload shorter than this value are delivered without
+     * using the pool.
+     */
+    size_t                   min_length;
+} ucp_am_recv_pool_t;
+
+
 /**
  * @ingroup UCP_WORKER
  * @brief Active Message handler parameters passed to
@@ -1921,6 +2006,12 @@ typedef struct ucp_am_handler_param {
      * @ref ucp_am_recv_callback_t function as the @a arg argument.
      */
     void                     *arg;
+
+    /**
+     * Application-owned buffer pool used for receiving eager messages with
+     * this id. Both @a get and @a put routines must be set.
+     */
+    ucp_am_recv_pool_t       recv_pool;
 } ucp_am_handler_param_t;
 
 
@@ -2289,6 +2380,28 @@ void ucp_worker_print_info(ucp_worker_h worker, FILE *stream);
 void ucp_worker_release_address(ucp_worker_h worker, ucp_address_t *address);
 
 
+/**
+ * @ingroup UCP_WORKER
+ * @brief Import an address dictionary of a remote worker.
+ *
+ * This routine makes the address dictionary known to the local worker, so
+ * compact addresses which refer to it could be used to create endpoints.
+ * Importing the same dictionary more than once has no effect. The dictionary
+ * is kept until the worker is destroyed.
+ *
+ * @param [in]  worker       Worker object to import the dictionary to.
+ * @param [in]  dict         Address dictionary, obtained on the remote worker
+ *                           by @ref ucp_worker_query "ucp_worker_query()" with
+ *                           @ref UCP_WORKER_ATTR_FIELD_ADDRESS_DICT.
+ * @param [in]  dict_length  Size of the address dictionary in bytes.
+ *
+ * @return Error code as defined by @ref ucs_status_t.
+ */
+ucs_status_t ucp_worker_address_dict_import(ucp_worker_h worker,
+                                            const ucp_address_t *dict,
+                                            size_t dict_length);
+
+
 /**
  * @ingroup UCP_WORKER
  * @brief Get attributes of the particular worker address.
@@ -2655,6 +2768,37 @@ ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
                            ucp_ep_h *ep_p);
 
 
+/**
+ * @ingroup UCP_ENDPOINT
+ * @brief Create and connect multiple endpoints.
+ *
+ * This routine creates @a count endpoints on @a worker, as if
+ * @ref ucp_ep_create was called for every element of @a params, but takes the
+ * worker's internal locks only once. When the endpoints are created with
+ * @ref UCP_EP_PARAMS_FLAGS_CLIENT_SERVER, the connection establishment of all
+ * of them proceeds in the background concurrently; the number of handshakes a
+ * connection manager keeps in flight may be limited by its configuration
+ * (e.g. UCX_TCP_CM_MAX_CONNECTING).
+ *
+ * @param [in]  worker      Handle to the worker; the endpoints
+ *                          are associated with the worker.
+ * @param [in]  params      Array of @a count @ref ucp_ep_params_t
+ *                          configurations, one per endpoint.
+ * @param [in]  count       Number of endpoints to create.
+ * @param [out] ep_p        Array of @a count handles filled with the created
+ *                          endpoints.
+ *
+ * @return Error code as defined by @ref ucs_status_t
+ *
+ * @note If the creation of an endpoint fails, the routine stops and returns
+ *       the error. The endpoints created before the failed one stay valid
+ *       and must be closed by the user; the rest of @a ep_p is set to NULL.
+ */
+ucs_status_t ucp_ep_create_bulk(ucp_worker_h worker,
+                                const ucp_ep_params_t *params, size_t count,
+                                ucp_ep_h *ep_p);
+
+
 /**
  * @ingroup UCP_ENDPOINT
  *
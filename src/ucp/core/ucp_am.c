@@ -48,11 +48,29 @@ void ucp_am_ep_init(ucp_ep_h ep)
     ucp_ep_ext_t *ep_ext = ep->ext;
 
     if (ep->worker->context->config.features & UCP_FEATURE_AM) {
-        ucs_list_head_init(&ep_ext->am.started_ams);
-        ucs_queue_head_init(&ep_ext->am.mid_rdesc_q);
+        ucs_list_head_init(&ep_ext->am->started_ams);
+        ucs_queue_head_init(&ep_ext->am->mid_rdesc_q);
     }
 }
 
+static void ucp_am_release_first_rdesc(ucp_worker_h worker,
+                                       ucp_recv_desc_t *first_rdesc)
+{
+    ucp_am_first_ftr_t *first_ftr = (ucp_am_first_ftr_t*)(first_rdesc + 1);
+    ucp_am_hdr_t *hdr             = (ucp_am_hdr_t*)(first_ftr + 1);
+    ucp_am_entry_t *am_cb;
+
+    if (first_rdesc->am_first.buffer != NULL) {
+        am_cb = &ucs_array_elem(&worker->am.cbs, hdr->am_id);
+        if (am_cb->recv_pool.put != NULL) {
+            am_cb->recv_pool.put(am_cb->recv_pool.arg,
+                                 first_rdesc->am_first.buffer);
+        }
+    }
+
+    ucs_free(first_rdesc);
+}
+
 void ucp_am_ep_cleanup(ucp_ep_h ep)
 {
     ucp_ep_ext_t *ep_ext = ep->ext;
@@ -65,19 +83,19 @@ void ucp_am_ep_cleanup(ucp_ep_h ep)
     }
 
     count = 0;
-    ucs_list_for_each_safe(rdesc, tmp_rdesc, &ep_ext->am.started_ams,
+    ucs_list_for_each_safe(rdesc, tmp_rdesc, &ep_ext->am->started_ams,
                            am_first.list) {
         ucs_list_del(&rdesc->am_first.list);
-        ucs_free(rdesc);
+        ucp_am_release_first_rdesc(ep->worker, rdesc);
         ++count;
     }
     ucs_trace_data("worker %p: %zu unhandled first AM fragments have been"
                    " dropped on ep %p", ep->worker, count, ep);
 
     count = 0;
-    ucs_queue_for_each_safe(rdesc, iter, &ep_ext->am.mid_rdesc_q,
+    ucs_queue_for_each_safe(rdesc, iter, &ep_ext->am->mid_rdesc_q,
                             am_mid_queue) {
-        ucs_queue_del_iter(&ep_ext->am.mid_rdesc_q, iter);
+        ucs_queue_del_iter(&ep_ext->am->mid_rdesc_q, iter);
         ucp_recv_desc_release(rdesc);
         ++count;
     }
@@ -167,13 +185,20 @@ UCS_PROFILE_FUNC_VOID(ucp_am_data_release, (worker, data),
 static void ucp_worker_am_init_handler(ucp_worker_h worker, uint16_t id,
                                        void *context, unsigned flags,
                                        ucp_am_callback_t cb_old,
-                                       ucp_am_recv_callback_t cb)
+                                       ucp_am_recv_callback_t cb,
+                                       const ucp_am_recv_pool_t *recv_pool)
 {
     ucp_am_entry_t *am_cb = &ucs_array_elem(&worker->am.cbs, id);
 
     am_cb->context = context;
     am_cb->flags   = flags;
 
+    if (recv_pool != NULL) {
+        am_cb->recv_pool = *recv_pool;
+    } else {
+        memset(&am_cb->recv_pool, 0, sizeof(am_cb->recv_pool));
+    }
+
     if (cb_old != NULL) {
         ucs_assert(cb == NULL);
         am_cb->cb_old = cb_old;
@@ -223,7 +248,7 @@ ucs_status_t ucp_worker_set_am_handler(ucp_worker_h worker, uint16_t id,
         goto out;
     }
 
-    ucp_worker_am_init_handler(worker, id, arg, flags, cb, NULL);
+    ucp_worker_am_init_handler(worker, id, arg, flags, cb, NULL, NULL);
 
 out:
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
@@ -323,6 +348,7 @@ static ucs_status_t ucp_am_check_id(unsigned am_id)
 ucs_status_t ucp_worker_set_am_recv_handler(ucp_worker_h worker,
                                             const ucp_am_handler_param_t *param)
 {
+    const ucp_am_recv_pool_t *recv_pool = NULL;
     ucs_status_t status;
     uint16_t id;
     unsigned flags;
@@ -337,6 +363,15 @@ ucs_status_t ucp_worker_set_am_recv_handler(ucp_worker_h worker,
         return status;
     }
 
+    if (param->field_mask & UCP_AM_HANDLER_PARAM_FIELD_RECV_POOL) {
+        recv_pool = &param->recv_pool;
+        if ((recv_pool->get == NULL) || (recv_pool->put == NULL)) {
+            ucs_error("AM id %u: receive pool must provide get and put "
+                      "routines", param->id);
+            return UCS_ERR_INVALID_PARAM;
+        }
+    }
+
     id    = param->id;
     flags = UCP_PARAM_VALUE(AM_HANDLER, param, flags, FLAGS, 0);
 
@@ -351,7 +386,7 @@ ucs_status_t ucp_worker_set_am_recv_handler(ucp_worker_h worker,
     ucp_worker_am_init_handler(worker, id,
                                UCP_PARAM_VALUE(AM_HANDLER, param, arg, ARG, NULL),
                                flags | UCP_AM_CB_PRIV_FLAG_NBX,
-                               NULL, param->cb);
+                               NULL, param->cb, recv_pool);
 
 out:
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
@@ -1236,6 +1271,66 @@ ucp_am_invoke_cb(ucp_worker_h worker, uint16_t am_id, void *user_hdr,
     return am_cb->cb_old(am_cb->context, data, data_length, reply_ep, flags);
 }
 
+static UCS_F_ALWAYS_INLINE const ucp_am_recv_pool_t *
+ucp_am_recv_pool(ucp_worker_h worker, uint16_t am_id, size_t data_length)
+{
+    const ucp_am_entry_t *am_cb;
+
+    if (ucs_unlikely(am_id >= ucs_array_length(&worker->am.cbs))) {
+        return NULL;
+    }
+
+    am_cb = &ucs_array_elem(&worker->am.cbs, am_id);
+    if (ucs_likely(am_cb->recv_pool.get == NULL) ||
+        (data_length < am_cb->recv_pool.min_length)) {
+        return NULL;
+    }
+
+    return &am_cb->recv_pool;
+}
+
+static void
+ucp_am_invoke_cb_recv_pool(ucp_worker_h worker, uint16_t am_id,
+                           void *user_hdr, uint32_t user_hdr_length,
+                           void *buffer, size_t data_length,
+                           ucp_ep_h reply_ep, uint64_t recv_flags)
+{
+    /* The callback may reset the handler, so keep a copy of the pool */
+    ucp_am_recv_pool_t recv_pool = ucs_array_elem(&worker->am.cbs,
+                                                  am_id).recv_pool;
+    ucs_status_t status;
+
+    status = ucp_am_invoke_cb(worker, am_id, user_hdr, user_hdr_length,
+                              buffer, data_length, reply_ep,
+                              recv_flags | UCP_AM_RECV_ATTR_FLAG_POOL);
+    if ((status != UCS_INPROGRESS) && (recv_pool.put != NULL)) {
+        /* User does not hold the buffer, return it to the pool */
+        recv_pool.put(recv_pool.arg, buffer);
+    }
+}
+
+static ucs_status_t
+ucp_am_handler_recv_pool(ucp_worker_h worker,
+                         const ucp_am_recv_pool_t *recv_pool, uint16_t am_id,
+                         void *user_hdr, uint32_t user_hdr_length, void *data,
+                         size_t data_length, ucp_ep_h reply_ep,
+                         uint64_t recv_flags)
+{
+    void *buffer;
+
+    buffer = recv_pool->get(recv_pool->arg, data_length);
+    if (buffer == NULL) {
+        return UCS_ERR_NO_RESOURCE;
+    }
+
+    UCS_PROFILE_NAMED_CALL("am_memcpy_recv", ucs_memcpy_relaxed, buffer, data,
+                           data_length, UCS_ARCH_MEMCPY_NT_SOURCE,
+                           data_length);
+    ucp_am_invoke_cb_recv_pool(worker, am_id, user_hdr, user_hdr_length,
+                               buffer, data_length, reply_ep, recv_flags);
+    return UCS_OK;
+}
+
 static UCS_F_ALWAYS_INLINE ucs_status_t ucp_am_handler_common(
         ucp_worker_h worker, ucp_am_hdr_t *am_hdr, size_t total_length,
         ucp_ep_h reply_ep, unsigned am_flags, uint64_t recv_flags,
@@ -1250,10 +1345,21 @@ static UCS_F_ALWAYS_INLINE ucs_status_t ucp_am_handler_common(
                                (sizeof(*am_hdr) + am_hdr->header_length);
     void *user_hdr           = UCS_PTR_BYTE_OFFSET(data, data_length);
     ucs_status_t desc_status = UCS_OK;
+    const ucp_am_recv_pool_t *recv_pool;
     ucs_status_t status;
 
     ucs_assert(total_length >= am_hdr->header_length + sizeof(*am_hdr));
 
+    /* Copy the data to the user pool buffer, so UCT descriptor is released
+     * right away. If the pool is empty, fall back to the regular flow. */
+    recv_pool = ucp_am_recv_pool(worker, am_id, data_length);
+    if (ucs_unlikely(recv_pool != NULL) &&
+        (ucp_am_handler_recv_pool(worker, recv_pool, am_id, user_hdr,
+                                  user_hdr_size, data, data_length, reply_ep,
+                                  recv_flags) == UCS_OK)) {
+        return UCS_OK;
+    }
+
     /* Initialize desc in advance, so the user could invoke ucp_am_recv_data_nbx
      * from the AM callback directly. The only exception is inline data when
      * AM callback is registered without UCP_AM_FLAG_PERSISTENT_DATA flag.
@@ -1350,7 +1456,7 @@ ucp_am_find_first_rdesc(ucp_worker_h worker, ucp_ep_ext_t *ep_ext,
     ucp_recv_desc_t *rdesc;
     ucp_am_first_ftr_t *first_ftr;
 
-    ucs_list_for_each(rdesc, &ep_ext->am.started_ams, am_first.list) {
+    ucs_list_for_each(rdesc, &ep_ext->am->started_ams, am_first.list) {
         first_ftr = (ucp_am_first_ftr_t*)(rdesc + 1);
         if (first_ftr->super.msg_id == msg_id) {
             return rdesc;
@@ -1360,12 +1466,24 @@ ucp_am_find_first_rdesc(ucp_worker_h worker, ucp_ep_ext_t *ep_ext,
     return NULL;
 }
 
+static UCS_F_ALWAYS_INLINE void *
+ucp_am_first_rdesc_payload(ucp_recv_desc_t *first_rdesc)
+{
+    if (first_rdesc->am_first.buffer != NULL) {
+        return first_rdesc->am_first.buffer;
+    }
+
+    return UCS_PTR_BYTE_OFFSET(first_rdesc + 1, first_rdesc->payload_offset);
+}
+
 static UCS_F_ALWAYS_INLINE void
 ucp_am_copy_data_fragment(ucp_recv_desc_t *first_rdesc, void *data,
                           size_t length, size_t offset)
 {
     UCS_PROFILE_NAMED_CALL("am_memcpy_recv", ucs_memcpy_relaxed,
-                           UCS_PTR_BYTE_OFFSET(first_rdesc + 1, offset),
+                           UCS_PTR_BYTE_OFFSET(
+                                   ucp_am_first_rdesc_payload(first_rdesc),
+                                   offset),
                            data, length, UCS_ARCH_MEMCPY_NT_SOURCE, length);
     first_rdesc->am_first.remaining -= length;
 }
@@ -1411,13 +1529,29 @@ ucp_am_handle_unfinished(ucp_worker_h worker, ucp_recv_desc_t *first_rdesc,
     first_ftr       = (ucp_am_first_ftr_t*)(first_rdesc + 1);
     hdr             = (ucp_am_hdr_t*)(first_ftr + 1);
     recv_flags      = ucp_am_hdr_reply_ep(worker, hdr->flags, reply_ep,
-                                          &reply_ep) |
-                      UCP_AM_RECV_ATTR_FLAG_DATA;
-    payload         = UCS_PTR_BYTE_OFFSET(first_rdesc + 1,
-                                          first_rdesc->payload_offset);
+                                          &reply_ep);
     am_id           = hdr->am_id;
     user_hdr_length = hdr->header_length;
     total_size      = first_ftr->total_size;
+
+    if (first_rdesc->am_first.buffer != NULL) {
+        /* Payload is assembled in the user pool buffer, and the descriptor
+         * holds only the headers:
+         *
+         * |desc|first_ftr|base_hdr|user_hdr|
+         */
+        user_hdr = UCS_PTR_BYTE_OFFSET(first_rdesc + 1,
+                                       first_rdesc->payload_offset);
+        ucp_am_invoke_cb_recv_pool(worker, am_id, user_hdr, user_hdr_length,
+                                   first_rdesc->am_first.buffer, total_size,
+                                   reply_ep, recv_flags);
+        ucs_free(first_rdesc);
+        return;
+    }
+
+    recv_flags     |= UCP_AM_RECV_ATTR_FLAG_DATA;
+    payload         = UCS_PTR_BYTE_OFFSET(first_rdesc + 1,
+                                          first_rdesc->payload_offset);
     user_hdr        = UCS_PTR_BYTE_OFFSET(payload, total_size);
 
     /* Need to reinit descriptor, because we have two headers between rdesc and
@@ -1458,14 +1592,16 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
     ucp_worker_h worker    = am_arg;
     ucp_am_hdr_t *hdr      = am_data;
     size_t user_hdr_length = hdr->header_length;
+    void *buffer           = NULL;
     ucp_recv_desc_t *mid_rdesc, *first_rdesc;
     ucp_am_mid_hdr_t *mid_hdr;
     ucp_am_mid_ftr_t *mid_ftr;
     ucp_am_first_ftr_t *first_ftr;
+    const ucp_am_recv_pool_t *recv_pool;
     ucs_queue_iter_t iter;
     ucp_ep_h ep;
     ucp_ep_ext_t *ep_ext;
-    size_t total_length, padding;
+    size_t total_length, padding, payload_length, max_padding;
     uint64_t recv_flags;
     void *user_hdr;
 
@@ -1489,10 +1625,25 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
     }
 
     /* This is the first fragment, other fragments (if arrived) should be on
-     * ep_ext->am.mid_rdesc_q queue */
+     * ep_ext->am->mid_rdesc_q queue */
     ucs_assert(NULL == ucp_am_find_first_rdesc(worker, ep_ext,
                                                first_ftr->super.msg_id));
 
+    /* If the user registered a receive pool, assemble the payload directly
+     * in the pool buffer. */
+    recv_pool = ucp_am_recv_pool(worker, hdr->am_id, first_ftr->total_size);
+    if (ucs_unlikely(recv_pool != NULL)) {
+        buffer = recv_pool->get(recv_pool->arg, first_ftr->total_size);
+    }
+
+    if (buffer == NULL) {
+        payload_length = first_ftr->total_size;
+        max_padding    = worker->am.alignment;
+    } else {
+        payload_length = 0;
+        max_padding    = 0;
+    }
+
     /* Alloc buffer for the data and its desc, as we know total_size.
      * Need to allocate a separate rdesc which would be in one contiguous chunk
      * with data buffer. The layout of assembled message is below:
@@ -1503,22 +1654,31 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
      *
      * Note: footer is added right after rdesc (unlike wire format) for easier
      * access to it while processing incoming fragments.
+     * If the payload is assembled in the user pool buffer, it is omitted from
+     * this layout together with the padding.
      */
-    first_rdesc = ucs_malloc(total_length + sizeof(ucp_recv_desc_t) +
-                                     worker->am.alignment,
+    first_rdesc = ucs_malloc(sizeof(ucp_recv_desc_t) +
+                                     UCP_AM_FIRST_FRAG_META_LEN +
+                                     user_hdr_length + payload_length +
+                                     max_padding,
                              "ucp recv desc for long AM");
     if (ucs_unlikely(first_rdesc == NULL)) {
         ucs_error("failed to allocate buffer for assembling UCP AM (id %u)",
                   hdr->am_id);
+        if (buffer != NULL) {
+            recv_pool->put(recv_pool->arg, buffer);
+        }
         return UCS_OK; /* release UCT desc */
     }
 
-    padding = ucs_padding((uintptr_t)UCS_PTR_BYTE_OFFSET(
+    padding = (buffer != NULL) ? 0 :
+              ucs_padding((uintptr_t)UCS_PTR_BYTE_OFFSET(
                                   first_rdesc + 1, UCP_AM_FIRST_FRAG_META_LEN),
                           worker->am.alignment);
 
     first_rdesc->payload_offset     = UCP_AM_FIRST_FRAG_META_LEN + padding;
     first_rdesc->am_first.remaining = first_ftr->total_size;
+    first_rdesc->am_first.buffer    = buffer;
 
     /* Copy first fragment and base headers before the data, it will be needed
      * for middle fragments processing. */
@@ -1536,12 +1696,12 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
     UCS_PROFILE_NAMED_CALL("am_memcpy_recv", ucs_memcpy_relaxed,
                            UCS_PTR_BYTE_OFFSET(first_rdesc + 1,
                                                first_rdesc->payload_offset +
-                                                       first_ftr->total_size),
+                                                       payload_length),
                            user_hdr, user_hdr_length,
                            UCS_ARCH_MEMCPY_NT_SOURCE, user_hdr_length);
 
     /* Copy all already arrived middle fragments to the data buffer */
-    ucs_queue_for_each_safe(mid_rdesc, iter, &ep_ext->am.mid_rdesc_q,
+    ucs_queue_for_each_safe(mid_rdesc, iter, &ep_ext->am->mid_rdesc_q,
                             am_mid_queue) {
         mid_ftr = UCS_PTR_BYTE_OFFSET(mid_rdesc + 1,
                                       mid_rdesc->length - sizeof(*mid_ftr));
@@ -1550,22 +1710,21 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_first_handler,
         }
 
         mid_hdr = (ucp_am_mid_hdr_t*)(mid_rdesc + 1);
-        ucs_queue_del_iter(&ep_ext->am.mid_rdesc_q, iter);
+        ucs_queue_del_iter(&ep_ext->am->mid_rdesc_q, iter);
         ucp_am_copy_data_fragment(first_rdesc, mid_hdr + 1,
                                   mid_rdesc->length - UCP_AM_MID_FRAG_META_LEN,
-                                  mid_hdr->offset +
-                                          first_rdesc->payload_offset);
+                                  mid_hdr->offset);
         ucp_recv_desc_release(mid_rdesc);
     }
 
-    ucs_list_add_tail(&ep_ext->am.started_ams, &first_rdesc->am_first.list);
+    ucs_list_add_tail(&ep_ext->am->started_ams, &first_rdesc->am_first.list);
 
     /* Note: copy first chunk of data together with AM header, which contains
      * data needed to process other fragments. */
     ucp_am_handle_unfinished(worker, first_rdesc, hdr + 1,
                              am_length - (user_hdr_length +
                                           UCP_AM_FIRST_FRAG_META_LEN),
-                             first_rdesc->payload_offset, ep);
+                             0, ep);
 
     return UCS_OK; /* release UCT desc */
 }
@@ -1597,8 +1756,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_middle_handler,
         /* First fragment already arrived, just copy the data */
         ucp_am_handle_unfinished(worker, first_rdesc, mid_hdr + 1,
                                  am_length - UCP_AM_MID_FRAG_META_LEN,
-                                 mid_hdr->offset + first_rdesc->payload_offset,
-                                 ep);
+                                 mid_hdr->offset, ep);
         return UCS_OK; /* data is copied, release UCT desc */
     }
 
@@ -1615,7 +1773,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_am_long_middle_handler,
     }
 
     ucs_assert(mid_rdesc != NULL);
-    ucs_queue_push(&ep_ext->am.mid_rdesc_q, &mid_rdesc->am_mid_queue);
+    ucs_queue_push(&ep_ext->am->mid_rdesc_q, &mid_rdesc->am_mid_queue);
 
     return status;
 }
@@ -44,6 +44,8 @@ typedef struct ucp_am_entry {
     void                       *context;   /* user defined callback argument */
     unsigned                   flags;      /* flags affecting callback behavior
                                               (set by the user) */
+    ucp_am_recv_pool_t         recv_pool;  /* user buffer pool for eager data,
+                                              get is NULL if not set */
 } ucp_am_entry_t;
 
 
@@ -118,6 +120,9 @@ typedef struct {
 typedef struct {
     ucs_list_link_t          list;        /* entry into list of unfinished AM's */
     size_t                   remaining;   /* how many bytes left to receive */
+    void                     *buffer;     /* user pool buffer the payload is
+                                             assembled to, or NULL if payload
+                                             follows the descriptor */
 } ucp_am_first_desc_t;
 
 
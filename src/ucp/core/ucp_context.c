@@ -213,6 +213,13 @@ static ucs_config_field_t ucp_context_config_table[] = {
    ucs_offsetof(ucp_context_config_t, multi_path_ratio),
    UCS_CONFIG_TYPE_POS_DOUBLE},
 
+  {"MULTI_LANE_STEAL", "y",
+   "Allow a multi-lane protocol to send a fragment on another lane when the\n"
+   "designated lane has no send resources, so a congested or slower lane does\n"
+   "not hold back the whole transfer. Rendezvous protocols which select the\n"
+   "lane by fragment offset are not affected.",
+   ucs_offsetof(ucp_context_config_t, multi_lane_steal), UCS_CONFIG_TYPE_BOOL},
+
   {"MAX_EAGER_LANES", NULL, "",
    ucs_offsetof(ucp_context_config_t, max_eager_lanes), UCS_CONFIG_TYPE_UINT},
 
@@ -239,6 +246,15 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "multiple rails. Must be greater than 0.",
    ucs_offsetof(ucp_context_config_t, min_rndv_chunk_size), UCS_CONFIG_TYPE_MEMUNITS},
 
+  {"RNDV_REG_CHUNK_SIZE", "inf",
+   "Register the local buffer of a zero-copy rendezvous transfer, which is not\n"
+   "found in the registration cache, in chunks of this size. Each chunk is\n"
+   "registered while the previous one is being transferred, instead of\n"
+   "registering the whole buffer before the transfer starts. The chunks are kept\n"
+   "in the registration cache, and reused by next transfers of the same buffer.\n"
+   "'inf' disables chunked registration.",
+   ucs_offsetof(ucp_context_config_t, rndv_reg_chunk_size), UCS_CONFIG_TYPE_MEMUNITS},
+
   {"MIN_RMA_CHUNK_SIZE", "8k",
    "Minimum chunk size to split the message sent with RMA protocol on\n"
    "multiple rails. Must be greater than 0.",
@@ -306,6 +322,14 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "y      - Use mutex for multithreading support in UCP.",
    ucs_offsetof(ucp_context_config_t, use_mt_mutex), UCS_CONFIG_TYPE_BOOL},
 
+  {"MT_PROGRESS_COMBINING", "n",
+   "Use flat combining for worker progress in multi-threaded mode. A thread\n"
+   "which calls ucp_worker_progress() while another thread holds the worker\n"
+   "lock publishes a progress request instead of waiting for the lock, and the\n"
+   "lock holder performs one progress round on behalf of all waiting threads.",
+   ucs_offsetof(ucp_context_config_t, mt_progress_combining),
+   UCS_CONFIG_TYPE_BOOL},
+
   {"ADAPTIVE_PROGRESS", "y",
    "Enable adaptive progress mechanism, which turns on polling only on active\n"
    "transport interfaces.",
@@ -480,6 +504,13 @@ static ucs_config_field_t ucp_context_config_table[] = {
    "dynamically allocated memory.",
    ucs_offsetof(ucp_context_config_t, rkey_mpool_max_md), UCS_CONFIG_TYPE_INT},
 
+  {"RKEY_CACHE_SIZE", "0",
+   "Maximal number of remote keys kept in a per-worker cache by\n"
+   "ucp_ep_rkey_unpack(). Unpacking the same buffer on endpoints with the same\n"
+   "configuration returns a shared, reference-counted remote key. Unreferenced\n"
+   "keys are evicted in least recently used order. 0 disables the cache.",
+   ucs_offsetof(ucp_context_config_t, rkey_cache_size), UCS_CONFIG_TYPE_UINT},
+
   {"ADDRESS_VERSION", "v1",
    "Defines UCP worker address format obtained with ucp_worker_get_address() or\n"
    "ucp_worker_query() routines.",
@@ -582,6 +613,16 @@ static ucs_config_field_t ucp_context_config_table[] = {
    ucs_offsetof(ucp_context_config_t, connect_all_to_all),
    UCS_CONFIG_TYPE_BOOL},
 
+  {"LAZY_WIREUP", "n",
+   "Create endpoints to a remote worker address as stubs, which select lanes\n"
+   "and create transport endpoints only when the first operation is issued on\n"
+   "them or the peer connects to them. Operations issued before the wireup is\n"
+   "completed are queued. A stub holds the endpoint object, one wireup proxy\n"
+   "endpoint and a copy of the remote worker address. An unreachable peer is\n"
+   "reported to the endpoint error handler instead of failing the endpoint\n"
+   "creation. Endpoints to the local worker are always connected immediately.",
+   ucs_offsetof(ucp_context_config_t, lazy_wireup), UCS_CONFIG_TYPE_BOOL},
+
   {"SINGLE_NET_DEVICE", "n", "Use only one network device for all protocols.",
    ucs_offsetof(ucp_context_config_t, proto_use_single_net_device),
    UCS_CONFIG_TYPE_BOOL},
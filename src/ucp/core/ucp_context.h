@@ -74,6 +74,8 @@ typedef struct ucp_context_config {
     double                                 multi_lane_max_ratio;
     /* Bandwidth efficiency ratio */
     double                                 multi_path_ratio;
+    /** Send fragments on another lane when the current one is congested */
+    int                                    multi_lane_steal;
     /** Threshold for switching UCP to zero copy protocol */
     size_t                                 zcopy_thresh;
     /** Communication scheme in RNDV protocol */
@@ -116,6 +118,8 @@ typedef struct ucp_context_config {
     ucp_atomic_mode_t                      atomic_mode;
     /** If use mutex for MT support or not */
     int                                    use_mt_mutex;
+    /** Hand off worker progress between threads by flat combining */
+    int                                    mt_progress_combining;
     /** On-demand progress */
     int                                    adaptive_progress;
     /** Eager-am multi-lane support */
@@ -127,6 +131,8 @@ typedef struct ucp_context_config {
     /** Minimum allowed chunk size when splitting rndv message over multiple
      *  lanes */
     size_t                                 min_rndv_chunk_size;
+    /** Chunk size for registering the local buffer of a rendezvous transfer */
+    size_t                                 rndv_reg_chunk_size;
     /** Minimum allowed chunk size when splitting rma message over multiple
      *  lanes */
     size_t                                 min_rma_chunk_size;
@@ -174,6 +180,8 @@ typedef struct ucp_context_config {
     /** Remote keys with that many remote MDs or less would be allocated from a
       * memory pool.*/
     int                                    rkey_mpool_max_md;
+    /** Maximal number of entries in the worker remote key cache */
+    unsigned                               rkey_cache_size;
     /** Worker address format version */
     ucp_object_version_t                   worker_addr_version;
     /** Threshold for enabling RNDV data split alignment */
@@ -217,6 +225,9 @@ typedef struct ucp_context_config {
     /** Extend endpoint lanes connections of each local device to all remote
      *  devices */
     int                                    connect_all_to_all;
+    /** Defer lanes selection of endpoints created from a worker address until
+     *  the first operation */
+    int                                    lazy_wireup;
     /** Use only one network device for all protocols */
     int                                    proto_use_single_net_device;
     /** Local identificator on a single node */
@@ -186,24 +186,62 @@ static void ucp_ep_deallocate(ucp_ep_h ep)
     ucs_strided_alloc_put(&ep->worker->ep_alloc, ep);
 }
 
+static size_t ucp_ep_ext_size(ucp_context_h context)
+{
+    size_t size = sizeof(ucp_ep_ext_t);
+
+    if (context->config.features & UCP_FEATURE_STREAM) {
+        size += sizeof(ucp_ep_ext_stream_t);
+    }
+
+    if (context->config.features & UCP_FEATURE_AM) {
+        size += sizeof(ucp_ep_ext_am_t);
+    }
+
+    return size;
+}
+
 static ucp_ep_h ucp_ep_allocate(ucp_worker_h worker, const char *peer_name)
 {
+    uint64_t features = worker->context->config.features;
+    void *ext_tail;
     ucp_ep_h ep;
     ucp_lane_index_t lane;
     ucs_status_t status;
 
+#if !ENABLE_DEBUG_DATA && !UCS_ENABLE_ASSERT && !defined(ENABLE_STATS)
+    /* Fast-path fields of the endpoint must fit in one cache line */
+    UCS_STATIC_ASSERT(sizeof(ucp_ep_t) <= UCS_SYS_CACHE_LINE_SIZE);
+#endif
+
     ep = ucs_strided_alloc_get(&worker->ep_alloc, "ucp_ep");
     if (ep == NULL) {
         ucs_error("Failed to allocate ep");
         goto err;
     }
 
-    ep->ext = ucs_malloc(sizeof(*ep->ext), "ucp_ep_ext");
+    /* Feature state is allocated only for the enabled features */
+    ep->ext = ucs_malloc(ucp_ep_ext_size(worker->context), "ucp_ep_ext");
     if (ep->ext == NULL) {
         ucs_error("failed to allocate ep extension");
         goto err_free_ep;
     }
 
+    ext_tail = ep->ext + 1;
+    if (features & UCP_FEATURE_STREAM) {
+        ep->ext->stream         = ext_tail;
+        ep->ext->stream->ep_ext = ep->ext;
+        ext_tail                = ep->ext->stream + 1;
+    } else {
+        ep->ext->stream = NULL;
+    }
+
+    if (features & UCP_FEATURE_AM) {
+        ep->ext->am = ext_tail;
+    } else {
+        ep->ext->am = NULL;
+    }
+
     ep->ext->ep                           = ep;
     ep->refcount                          = 0;
     ep->cfg_index                         = UCP_WORKER_CFG_INDEX_NULL;
@@ -767,17 +805,16 @@ void ucp_worker_mem_type_eps_destroy(ucp_worker_h worker)
     UCS_ASYNC_UNBLOCK(&worker->async);
 }
 
-static ucs_status_t ucp_ep_init_create_wireup(ucp_ep_h ep,
-                                              unsigned ep_init_flags,
-                                              ucp_wireup_ep_t **wireup_ep)
+ucs_status_t ucp_ep_init_create_wireup(ucp_ep_h ep, unsigned ep_init_flags,
+                                       ucp_wireup_ep_t **wireup_ep)
 {
     ucp_ep_config_key_t key;
     uct_ep_h uct_ep;
     ucs_status_t status;
     ucp_worker_cfg_index_t cfg_index;
 
-    ucs_assert(ep_init_flags & UCP_EP_INIT_CM_WIREUP_CLIENT);
-    ucs_assert(ucp_worker_num_cm_cmpts(ep->worker) != 0);
+    ucs_assert(!ucp_ep_init_flags_has_cm(ep_init_flags) ||
+               (ucp_worker_num_cm_cmpts(ep->worker) != 0));
 
     ucp_ep_config_key_reset(&key);
     ucp_ep_config_key_set_err_mode(&key, ep_init_flags);
@@ -805,9 +842,6 @@ static ucs_status_t ucp_ep_init_create_wireup(ucp_ep_h ep,
 
     ucp_ep_set_cfg_index(ep, cfg_index);
     ep->am_lane = key.am_lane;
-    if (!ucp_ep_has_cm_lane(ep)) {
-        ucp_ep_update_flags(ep, UCP_EP_FLAG_CONNECT_REQ_QUEUED, 0);
-    }
 
     status = ucp_wireup_ep_create(ep, &uct_ep);
     if (status != UCS_OK) {
@@ -858,6 +892,49 @@ err:
     return status;
 }
 
+static ucs_status_t
+ucp_ep_create_lazy_to_worker_addr(ucp_worker_h worker,
+                                  const ucp_unpacked_address_t *remote_address,
+                                  const void *packed_address,
+                                  unsigned ep_init_flags, ucp_ep_h *ep_p)
+{
+    ucp_wireup_ep_t *wireup_ep;
+    ucs_status_t status;
+    ucp_ep_h ep;
+
+    status = ucp_ep_create_base(worker, ep_init_flags, remote_address->name,
+                                "lazy from api call", &ep);
+    if (status != UCS_OK) {
+        goto err;
+    }
+
+    /* The stub lane queues all operations until the lanes are initialized */
+    status = ucp_ep_init_create_wireup(ep, ep_init_flags, &wireup_ep);
+    if (status != UCS_OK) {
+        goto err_delete;
+    }
+
+    status = ucp_wireup_ep_set_lazy(&wireup_ep->super.super, packed_address,
+                                    remote_address->length, ep_init_flags);
+    if (status != UCS_OK) {
+        goto err_cleanup_lanes;
+    }
+
+    ucp_ep_update_flags(ep, UCP_EP_FLAG_LAZY_WIREUP, 0);
+
+    ucs_debug("ep %p: created lazy endpoint to %s, address length %zu", ep,
+              ucp_ep_peer_name(ep), remote_address->length);
+    *ep_p = ep;
+    return UCS_OK;
+
+err_cleanup_lanes:
+    ucp_ep_cleanup_lanes(ep);
+err_delete:
+    ucp_ep_delete(ep);
+err:
+    return status;
+}
+
 static ucs_status_t ucp_ep_create_to_sock_addr(ucp_worker_h worker,
                                                const ucp_ep_params_t *params,
                                                ucp_ep_h *ep_p)
@@ -1094,9 +1171,17 @@ ucp_ep_create_api_to_worker_addr(ucp_worker_h worker,
         goto out_resolve_remote_id;
     }
 
-    status = ucp_ep_create_to_worker_addr(worker, &ucp_tl_bitmap_max,
-                                          &remote_address, ep_init_flags,
-                                          "from api call", addr_indices, &ep);
+    if (context->config.ext.lazy_wireup &&
+        (remote_address.uuid != worker->uuid)) {
+        status = ucp_ep_create_lazy_to_worker_addr(worker, &remote_address,
+                                                   params->address,
+                                                   ep_init_flags, &ep);
+    } else {
+        status = ucp_ep_create_to_worker_addr(worker, &ucp_tl_bitmap_max,
+                                              &remote_address, ep_init_flags,
+                                              "from api call", addr_indices,
+                                              &ep);
+    }
     if (status != UCS_OK) {
         goto out_free_address;
     }
@@ -1128,8 +1213,10 @@ ucp_ep_create_api_to_worker_addr(ucp_worker_h worker,
         }
     }
 
-    /* if needed, send initial wireup message */
-    if (!(ep->flags & UCP_EP_FLAG_LOCAL_CONNECTED)) {
+    /* if needed, send initial wireup message, a lazy endpoint sends it when
+     * the first operation is issued */
+    if (!(ep->flags & (UCP_EP_FLAG_LOCAL_CONNECTED |
+                       UCP_EP_FLAG_LAZY_WIREUP))) {
         ucs_assert(!(ep->flags & UCP_EP_FLAG_CONNECT_REQ_QUEUED));
         status = ucp_wireup_send_request(ep);
         if (status != UCS_OK) {
@@ -1186,15 +1273,17 @@ static void ucp_ep_params_check_err_handling(ucp_ep_h ep,
              "keepalive and indirect id", ep);
 }
 
-ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
-                           ucp_ep_h *ep_p)
+/**
+ * The caller has to block async.
+ */
+static ucs_status_t ucp_ep_create_from_params(ucp_worker_h worker,
+                                              const ucp_ep_params_t *params,
+                                              ucp_ep_h *ep_p)
 {
     ucp_ep_h ep    = NULL;
     unsigned flags = UCP_PARAM_VALUE(EP, params, flags, FLAGS, 0);
     ucs_status_t status;
 
-    UCS_ASYNC_BLOCK(&worker->async);
-
     if (flags & UCP_EP_PARAMS_FLAGS_CLIENT_SERVER) {
         status = ucp_ep_create_to_sock_addr(worker, params, &ep);
     } else if (params->field_mask & UCP_EP_PARAM_FIELD_CONN_REQUEST) {
@@ -1224,6 +1313,45 @@ ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
     }
     ++worker->counters.ep_creations;
 
+    return status;
+}
+
+ucs_status_t ucp_ep_create(ucp_worker_h worker, const ucp_ep_params_t *params,
+                           ucp_ep_h *ep_p)
+{
+    ucs_status_t status;
+
+    UCS_ASYNC_BLOCK(&worker->async);
+    status = ucp_ep_create_from_params(worker, params, ep_p);
+    UCS_ASYNC_UNBLOCK(&worker->async);
+
+    return status;
+}
+
+ucs_status_t ucp_ep_create_bulk(ucp_worker_h worker,
+                                const ucp_ep_params_t *params, size_t count,
+                                ucp_ep_h *ep_p)
+{
+    ucs_status_t status = UCS_OK;
+    size_t i;
+
+    /* All connections are started before the async thread gets a chance to
+     * run, so their handshakes progress together instead of one by one */
+    UCS_ASYNC_BLOCK(&worker->async);
+
+    for (i = 0; i < count; ++i) {
+        status = ucp_ep_create_from_params(worker, &params[i], &ep_p[i]);
+        if (status != UCS_OK) {
+            ucs_debug("worker %p: bulk ep creation stopped at %zu/%zu: %s",
+                      worker, i, count, ucs_status_string(status));
+            break;
+        }
+    }
+
+    for (; i < count; ++i) {
+        ep_p[i] = NULL;
+    }
+
     UCS_ASYNC_UNBLOCK(&worker->async);
     return status;
 }
@@ -1600,6 +1728,33 @@ ucp_ep_config_deactivate_worker_ifaces(ucp_worker_h worker,
     }
 }
 
+void *ucp_ep_lazy_release_stub(ucp_ep_h ep, unsigned *ep_init_flags_p,
+                               ucs_queue_head_t *pending_queue)
+{
+    uct_ep_h uct_ep = ucp_ep_get_lane(ep, 0);
+    void *address;
+
+    UCP_WORKER_THREAD_CS_CHECK_IS_BLOCKED(ep->worker);
+    ucs_assert(ep->flags & UCP_EP_FLAG_LAZY_WIREUP);
+    ucs_assert(ucp_ep_num_lanes(ep) == 1);
+    ucs_assert(ucp_wireup_ep_test(uct_ep));
+
+    ucp_wireup_eps_pending_extract(ep, pending_queue);
+
+    *ep_init_flags_p = ucp_wireup_ep(uct_ep)->ep_init_flags;
+    address          = ucp_wireup_ep_extract_lazy_address(uct_ep);
+
+    ucp_ep_set_lane(ep, 0, NULL);
+    uct_ep_destroy(uct_ep);
+
+    /* The lanes are initialized as for a new endpoint */
+    ucp_ep_config_deactivate_worker_ifaces(ep->worker, ep->cfg_index);
+    ep->cfg_index = UCP_WORKER_CFG_INDEX_NULL;
+    ep->am_lane   = UCP_NULL_LANE;
+    ucp_ep_update_flags(ep, 0, UCP_EP_FLAG_LAZY_WIREUP);
+    return address;
+}
+
 void ucp_ep_cleanup_lanes(ucp_ep_h ep)
 {
     uct_ep_h uct_eps[UCP_MAX_LANES] = { NULL };
@@ -2683,9 +2838,13 @@ ucs_status_t ucp_ep_config_init(ucp_worker_h worker, ucp_ep_config_t *config,
         cmpt_attr = ucp_cmpt_attr_by_md_index(context, config->md_index[lane]);
         if (cmpt_attr->flags & UCT_COMPONENT_FLAG_RKEY_PTR) {
             dst_md_index = config->key.lanes[lane].dst_md_index;
+            iface_attr   = ucp_worker_iface_get_attr(worker, rsc_index);
             if (lane == key->rkey_ptr_lane) {
                 config->rndv.rkey_ptr_lane_dst_mds     = UCS_BIT(dst_md_index);
-            } else {
+            } else if (!(iface_attr->cap.flags &
+                         (UCT_IFACE_FLAG_GET_ZCOPY |
+                          UCT_IFACE_FLAG_PUT_ZCOPY))) {
+                /* Keys of lanes capable of zcopy RMA are used directly */
                 config->rndv.proto_rndv_rkey_skip_mds |= UCS_BIT(dst_md_index);
             }
         }
@@ -3330,6 +3489,19 @@ static void ucp_ep_config_print(FILE *stream, ucp_worker_h worker,
     }
 }
 
+size_t ucp_ep_memory_usage(ucp_ep_h ep)
+{
+    size_t size = sizeof(ucp_ep_t) + ucp_ep_ext_size(ep->worker->context);
+
+    if ((ep->cfg_index != UCP_WORKER_CFG_INDEX_NULL) &&
+        (ucp_ep_num_lanes(ep) > UCP_MAX_FAST_PATH_LANES)) {
+        size += (ucp_ep_num_lanes(ep) - UCP_MAX_FAST_PATH_LANES) *
+                sizeof(*ep->ext->uct_eps);
+    }
+
+    return size;
+}
+
 static void ucp_ep_print_info_internal(ucp_ep_h ep, const char *name,
                                        FILE *stream)
 {
@@ -3346,6 +3518,7 @@ static void ucp_ep_print_info_internal(ucp_ep_h ep, const char *name,
     fprintf(stream, "# UCP endpoint %s\n", name);
     fprintf(stream, "#\n");
     fprintf(stream, "#               peer: %s\n", ucp_ep_peer_name(ep));
+    fprintf(stream, "#             memory: %zu bytes\n", ucp_ep_memory_usage(ep));
 
     /* if there is a wireup lane, set aux_rsc_index to the stub ep resource */
     aux_rsc_index   = UCP_NULL_RESOURCE;
@@ -104,7 +104,8 @@ enum {
                                                         while merging pending queues */
     UCP_EP_FLAG_CONNECT_PRE_REQ_QUEUED = UCS_BIT(9), /* Pre-Connection request was queued */
     UCP_EP_FLAG_CLOSED                 = UCS_BIT(10),/* EP was closed */
-    /* 11 bit is vacant for a flag */
+    UCP_EP_FLAG_LAZY_WIREUP            = UCS_BIT(11),/* Lanes are not initialized yet, the
+                                                        first operation starts wireup */
     UCP_EP_FLAG_ERR_HANDLER_INVOKED    = UCS_BIT(12),/* error handler was called */
     UCP_EP_FLAG_INTERNAL               = UCS_BIT(13),/* the internal EP which holds
                                                         temporary wireup configuration or
@@ -504,6 +505,29 @@ typedef struct {
 } ucp_ep_flush_state_t;
 
 
+/**
+ * Stream state of an endpoint, allocated only if the context has
+ * UCP_FEATURE_STREAM
+ */
+typedef struct {
+    struct ucp_ep_ext             *ep_ext;        /* Back pointer to extension */
+    ucs_list_link_t               ready_list;     /* List entry in worker's EP list */
+    ucs_queue_head_t              match_q;        /* Queue of receive data or requests,
+                                                     depends on UCP_EP_FLAG_STREAM_HAS_DATA */
+} ucp_ep_ext_stream_t;
+
+
+/**
+ * Active message state of an endpoint, allocated only if the context has
+ * UCP_FEATURE_AM
+ */
+typedef struct {
+    ucs_list_link_t               started_ams;
+    ucs_queue_head_t              mid_rdesc_q;    /* Queue of middle fragments, which
+                                                     arrived before the first one */
+} ucp_ep_ext_am_t;
+
+
 /**
  * Endpoint extension
  */
@@ -511,7 +535,6 @@ typedef struct ucp_ep_ext {
     ucp_ep_h                      ep;            /* Back pointer to endpoint */
     void                          *user_data;    /* User data associated with ep */
     ucs_list_link_t               ep_list;       /* List entry in worker's all eps list */
-    ucp_rsc_index_t               cm_idx;        /* CM index */
     ucs_ptr_map_key_t             local_ep_id;   /* Local EP ID */
     ucs_ptr_map_key_t             remote_ep_id;  /* Remote EP ID */
     ucp_err_handler_cb_t          err_cb;        /* Error handler */
@@ -533,18 +556,11 @@ typedef struct ucp_ep_ext {
         ucp_ep_flush_state_t      flush_state;   /* Remote completion status */
     };
 
-    struct {
-        ucs_list_link_t           ready_list;     /* List entry in worker's EP list */
-        ucs_queue_head_t          match_q;        /* Queue of receive data or requests,
-                                                     depends on UCP_EP_FLAG_STREAM_HAS_DATA */
-    } stream;
-
-    struct {
-        ucs_list_link_t           started_ams;
-        ucs_queue_head_t          mid_rdesc_q;    /* Queue of middle fragments, which
-                                                     arrived before the first one */
-    } am;
+    /* Feature state, placed in the same allocation after the extension */
+    ucp_ep_ext_stream_t           *stream;
+    ucp_ep_ext_am_t               *am;
 
+    ucp_rsc_index_t               cm_idx;          /* CM index */
     ucp_lane_map_t                unflushed_lanes; /* Bitmap of lanes which have
                                                       unflushed operations */
     uint64_t                      fence_seq;       /* Sequence number for fence
@@ -943,6 +959,50 @@ ucs_status_t ucp_ep_realloc_lanes(ucp_ep_h ep, unsigned new_num_lanes);
 void ucp_ep_set_cfg_index(ucp_ep_h ep, ucp_worker_cfg_index_t cfg_index);
 
 
+/**
+ * @brief Get the memory used by the UCP-level state of an endpoint.
+ *
+ * Transport endpoints and the shared endpoint configuration are not included.
+ *
+ * @param [in] ep  Endpoint to query.
+ *
+ * @return Size in bytes of the endpoint, its extension and slow-path lanes.
+ */
+size_t ucp_ep_memory_usage(ucp_ep_h ep);
+
+
+/**
+ * @brief Initialize an endpoint with a single stub lane.
+ *
+ * All operations are queued on the stub lane until the endpoint lanes are
+ * initialized.
+ *
+ * @param [in]  ep            Endpoint without lanes.
+ * @param [in]  ep_init_flags Endpoint initialization flags.
+ * @param [out] wireup_ep     Filled with the stub lane.
+ *
+ * @return Error code as defined by @ref ucs_status_t
+ */
+ucs_status_t ucp_ep_init_create_wireup(ucp_ep_h ep, unsigned ep_init_flags,
+                                       ucp_wireup_ep_t **wireup_ep);
+
+
+/**
+ * @brief Release the stub lane of a lazy endpoint.
+ *
+ * The endpoint is left without a configuration, so that its lanes can be
+ * initialized as for a new endpoint.
+ *
+ * @param [in]  ep              Lazy endpoint.
+ * @param [out] ep_init_flags_p Filled with the endpoint initialization flags.
+ * @param [out] pending_queue   Filled with the operations queued on the stub.
+ *
+ * @return Packed remote worker address, which has to be released by the caller.
+ */
+void *ucp_ep_lazy_release_stub(ucp_ep_h ep, unsigned *ep_init_flags_p,
+                               ucs_queue_head_t *pending_queue);
+
+
 /**
  * @brief Progress function for memory specific remote flushing.
  *
@@ -276,6 +276,10 @@ struct ucp_request {
                         const void     *rkey_buffer;
                     };
 
+                    /* Chunks of the local buffer registered by zcopy
+                     * protocols, NULL if the buffer is not chunked */
+                    ucp_proto_rndv_reg_chunks_t *reg_chunks;
+
                     union {
                         /* Used by "old" rendezvous protocols, in rndv.c */
                         struct {
@@ -15,6 +15,8 @@
 #include <ucp/core/ucp_mm.inl>
 #include <ucp/rma/rma.h>
 #include <ucp/proto/proto_debug.h>
+#include <ucp/wireup/wireup.h>
+#include <ucs/algorithm/crc.h>
 #include <ucs/datastruct/mpool.inl>
 #include <ucs/profile/profile.h>
 #include <ucs/type/float8.h>
@@ -891,12 +893,64 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_rkey_proto_resolve,
                                       &rkey->cfg_index);
 }
 
-UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
-                 (ep, buffer, length, unpack_md_map, skip_md_map, sys_dev,
-                  rkey_p),
-                 ucp_ep_h ep, const void *buffer, size_t length,
-                 ucp_md_map_t unpack_md_map, ucp_md_map_t skip_md_map,
-                 ucs_sys_device_t sys_dev, ucp_rkey_h *rkey_p)
+static void ucp_rkey_free(ucp_rkey_h rkey)
+{
+    unsigned remote_md_index, rkey_index;
+    ucp_worker_h UCS_V_UNUSED worker;
+
+    rkey_index = 0;
+    ucs_for_each_bit(remote_md_index, rkey->md_map) {
+        if (rkey->tl_rkey[rkey_index].rkey.rkey != UCT_INVALID_RKEY) {
+            uct_rkey_release(rkey->tl_rkey[rkey_index].cmpt,
+                             &rkey->tl_rkey[rkey_index].rkey);
+        }
+        ++rkey_index;
+    }
+
+    if (rkey->flags & UCP_RKEY_DESC_FLAG_POOL) {
+        worker = ucs_container_of(ucs_mpool_obj_owner(rkey), ucp_worker_t,
+                                  rkey_mp);
+        UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+        ucs_mpool_put_inline(rkey);
+        UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+    } else if (rkey->flags & UCP_RKEY_DESC_FLAG_CACHED) {
+        ucs_free(ucs_container_of(rkey, ucp_rkey_cache_entry_t, rkey));
+    } else {
+        ucs_free(rkey);
+    }
+}
+
+static ucp_rkey_h
+ucp_rkey_cache_entry_alloc(ucp_worker_h worker, int md_count,
+                           const ucp_rkey_cache_key_t *key)
+{
+    ucp_rkey_cache_entry_t *entry;
+    void *key_buffer;
+
+    entry = ucs_malloc(sizeof(*entry) +
+                       (sizeof(entry->rkey.tl_rkey[0]) * md_count) +
+                       key->length, "ucp_rkey_cache_entry");
+    if (entry == NULL) {
+        return NULL;
+    }
+
+    key_buffer = &entry->rkey.tl_rkey[md_count];
+    memcpy(key_buffer, key->buffer, key->length);
+
+    entry->worker           = worker;
+    entry->refcount         = 1;
+    entry->key.buffer       = key_buffer;
+    entry->key.length       = key->length;
+    entry->key.ep_cfg_index = key->ep_cfg_index;
+    return &entry->rkey;
+}
+
+static ucs_status_t
+ucp_ep_rkey_unpack_common(ucp_ep_h ep, const void *buffer, size_t length,
+                          ucp_md_map_t unpack_md_map, ucp_md_map_t skip_md_map,
+                          ucs_sys_device_t sys_dev,
+                          const ucp_rkey_cache_key_t *cache_key,
+                          ucp_rkey_h *rkey_p)
 {
     ucp_worker_h worker              = ep->worker;
     const ucp_ep_config_t *ep_config = ucp_ep_config(ep);
@@ -930,9 +984,13 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
 
     /* Allocate rkey handle which holds UCT rkeys for all remote MDs. Small key
      * allocations are done from a memory pool.
-     * We keep all of them to handle a future transport switch.
+     * We keep all of them to handle a future transport switch. Cached keys
+     * are embedded in the cache entry along with a copy of the packed buffer.
      */
-    if (md_count <= worker->context->config.ext.rkey_mpool_max_md) {
+    if (cache_key != NULL) {
+        rkey  = ucp_rkey_cache_entry_alloc(worker, md_count, cache_key);
+        flags = UCP_RKEY_DESC_FLAG_CACHED;
+    } else if (md_count <= worker->context->config.ext.rkey_mpool_max_md) {
         rkey  = ucs_mpool_get_inline(&worker->rkey_mp);
         flags = UCP_RKEY_DESC_FLAG_POOL;
     } else {
@@ -950,7 +1008,8 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
     rkey->mem_type = *ucs_serialize_next(&p, const uint8_t);
     rkey->flags    = flags;
 #if ENABLE_PARAMS_CHECK
-    rkey->ep       = ep;
+    /* Cached keys are shared by all endpoints with the same configuration */
+    rkey->ep       = (cache_key == NULL) ? ep : NULL;
 #endif
 
     unpack_params.field_mask = UCT_RKEY_UNPACK_FIELD_SYS_DEVICE;
@@ -1029,19 +1088,232 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
     goto out;
 
 err_destroy:
-    ucp_rkey_destroy(rkey);
+    ucp_rkey_free(rkey);
 out:
     ucs_log_indent(-1);
     return status;
 }
 
+UCS_PROFILE_FUNC(ucs_status_t, ucp_ep_rkey_unpack_internal,
+                 (ep, buffer, length, unpack_md_map, skip_md_map, sys_dev,
+                  rkey_p),
+                 ucp_ep_h ep, const void *buffer, size_t length,
+                 ucp_md_map_t unpack_md_map, ucp_md_map_t skip_md_map,
+                 ucs_sys_device_t sys_dev, ucp_rkey_h *rkey_p)
+{
+    return ucp_ep_rkey_unpack_common(ep, buffer, length, unpack_md_map,
+                                     skip_md_map, sys_dev, NULL, rkey_p);
+}
+
+static UCS_F_ALWAYS_INLINE khint32_t
+ucp_rkey_cache_hash_func(ucp_rkey_cache_key_t key)
+{
+    return ucs_crc32c(key.ep_cfg_index, key.buffer, key.length);
+}
+
+static UCS_F_ALWAYS_INLINE int
+ucp_rkey_cache_is_equal(ucp_rkey_cache_key_t key1, ucp_rkey_cache_key_t key2)
+{
+    return (key1.ep_cfg_index == key2.ep_cfg_index) &&
+           (key1.length == key2.length) &&
+           (memcmp(key1.buffer, key2.buffer, key1.length) == 0);
+}
+
+KHASH_IMPL(ucp_worker_rkey_cache, ucp_rkey_cache_key_t,
+           ucp_rkey_cache_entry_t*, 1, ucp_rkey_cache_hash_func,
+           ucp_rkey_cache_is_equal);
+
+/*
+ * Return the length of the packed rkey prefix which is consumed by unpacking
+ * it on an endpoint with the given configuration. The system device and lane
+ * distances are taken into account under the same conditions as in
+ * ucp_rkey_proto_resolve().
+ */
+static size_t ucp_rkey_cache_key_length(const ucp_ep_config_t *ep_config,
+                                        const void *buffer)
+{
+    const void *p = buffer;
+    ucp_md_map_t md_map;
+    ucs_sys_device_t sys_dev;
+    unsigned md_index;
+    uint8_t tl_rkey_size;
+
+    md_map = *ucs_serialize_next(&p, const ucp_md_map_t);
+    ucs_serialize_next(&p, const uint8_t); /* mem_type */
+
+    ucs_for_each_bit(md_index, md_map) {
+        tl_rkey_size = *ucs_serialize_next(&p, const uint8_t);
+        ucs_serialize_next_raw(&p, const void, tl_rkey_size);
+    }
+
+    if ((ep_config->key.dst_version <= 19) ||
+        !(md_map & ep_config->key.reachable_md_map)) {
+        goto out;
+    }
+
+    sys_dev = *ucs_serialize_next(&p, const uint8_t);
+    if (sys_dev == UCS_SYS_DEVICE_ID_UNKNOWN) {
+        goto out;
+    }
+
+    while (*(const uint8_t*)p != UCS_SYS_DEVICE_ID_UNKNOWN) {
+        ucs_serialize_next(&p, const ucp_rkey_packed_distance_t);
+    }
+    ucs_serialize_next(&p, const uint8_t); /* terminator */
+
+out:
+    return UCS_PTR_BYTE_DIFF(buffer, p);
+}
+
+static void
+ucp_rkey_cache_remove(ucp_worker_h worker, ucp_rkey_cache_entry_t *entry)
+{
+    khiter_t khiter;
+
+    khiter = kh_get(ucp_worker_rkey_cache, &worker->rkey_cache.hash,
+                    entry->key);
+    ucs_assert(khiter != kh_end(&worker->rkey_cache.hash));
+    kh_del(ucp_worker_rkey_cache, &worker->rkey_cache.hash, khiter);
+
+    --worker->rkey_cache.count;
+    ucp_rkey_free(&entry->rkey);
+}
+
+static int ucp_rkey_cache_evict(ucp_worker_h worker)
+{
+    ucp_rkey_cache_entry_t *entry;
+
+    if (ucs_list_is_empty(&worker->rkey_cache.lru)) {
+        return 0;
+    }
+
+    entry = ucs_list_extract_head(&worker->rkey_cache.lru,
+                                  ucp_rkey_cache_entry_t, list);
+    ucs_trace("worker %p: evicting cached rkey %p", worker, &entry->rkey);
+    ucp_rkey_cache_remove(worker, entry);
+    UCS_STATS_UPDATE_COUNTER(worker->stats, UCP_WORKER_STAT_RKEY_CACHE_EVICT,
+                             1);
+    return 1;
+}
+
+static ucs_status_t
+ucp_ep_rkey_unpack_cached(ucp_ep_h ep, const void *buffer, ucp_rkey_h *rkey_p)
+{
+    ucp_worker_h worker              = ep->worker;
+    const ucp_ep_config_t *ep_config = ucp_ep_config(ep);
+    ucp_rkey_cache_entry_t *entry;
+    ucp_rkey_cache_key_t key;
+    ucs_status_t status;
+    ucp_rkey_h rkey;
+    khiter_t khiter;
+    int khret;
+
+    key.buffer       = buffer;
+    key.length       = ucp_rkey_cache_key_length(ep_config, buffer);
+    key.ep_cfg_index = ep->cfg_index;
+
+    khiter = kh_get(ucp_worker_rkey_cache, &worker->rkey_cache.hash, key);
+    if (khiter != kh_end(&worker->rkey_cache.hash)) {
+        entry = kh_val(&worker->rkey_cache.hash, khiter);
+        if (entry->refcount++ == 0) {
+            ucs_list_del(&entry->list);
+        }
+
+        UCS_STATS_UPDATE_COUNTER(worker->stats,
+                                 UCP_WORKER_STAT_RKEY_CACHE_HIT, 1);
+        ucs_trace("ep %p: found cached rkey %p refcount %u", ep, &entry->rkey,
+                  entry->refcount);
+        *rkey_p = &entry->rkey;
+        return UCS_OK;
+    }
+
+    UCS_STATS_UPDATE_COUNTER(worker->stats, UCP_WORKER_STAT_RKEY_CACHE_MISS, 1);
+
+    if ((worker->rkey_cache.count >=
+         worker->context->config.ext.rkey_cache_size) &&
+        !ucp_rkey_cache_evict(worker)) {
+        /* All cached keys are in use, return a private key */
+        return ucp_ep_rkey_unpack_reachable(ep, buffer, 0, rkey_p);
+    }
+
+    status = ucp_ep_rkey_unpack_common(ep, buffer, 0,
+                                       ep_config->key.reachable_md_map, 0,
+                                       UCS_SYS_DEVICE_ID_UNKNOWN, &key, &rkey);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    entry  = ucs_container_of(rkey, ucp_rkey_cache_entry_t, rkey);
+    khiter = kh_put(ucp_worker_rkey_cache, &worker->rkey_cache.hash,
+                    entry->key, &khret);
+    if (khret == UCS_KH_PUT_FAILED) {
+        ucp_rkey_free(rkey);
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    ucs_assert(khret != UCS_KH_PUT_KEY_PRESENT);
+    kh_val(&worker->rkey_cache.hash, khiter) = entry;
+    ++worker->rkey_cache.count;
+
+    *rkey_p = rkey;
+    return UCS_OK;
+}
+
+static void ucp_rkey_cache_release(ucp_rkey_h rkey)
+{
+    ucp_rkey_cache_entry_t *entry = ucs_container_of(rkey,
+                                                     ucp_rkey_cache_entry_t,
+                                                     rkey);
+    ucp_worker_h worker           = entry->worker;
+
+    UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+    ucs_assert(entry->refcount > 0);
+    if (--entry->refcount == 0) {
+        ucs_list_add_tail(&worker->rkey_cache.lru, &entry->list);
+    }
+    UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+}
+
+void ucp_rkey_cache_init(ucp_worker_h worker)
+{
+    kh_init_inplace(ucp_worker_rkey_cache, &worker->rkey_cache.hash);
+    ucs_list_head_init(&worker->rkey_cache.lru);
+    worker->rkey_cache.count = 0;
+}
+
+void ucp_rkey_cache_cleanup(ucp_worker_h worker)
+{
+    ucp_rkey_cache_entry_t *entry;
+
+    kh_foreach_value(&worker->rkey_cache.hash, entry, {
+        if (entry->refcount != 0) {
+            ucs_warn("worker %p: cached rkey %p was not destroyed "
+                     "(refcount %u)", worker, &entry->rkey, entry->refcount);
+        }
+        ucp_rkey_free(&entry->rkey);
+    })
+
+    kh_destroy_inplace(ucp_worker_rkey_cache, &worker->rkey_cache.hash);
+    ucs_list_head_init(&worker->rkey_cache.lru);
+    worker->rkey_cache.count = 0;
+}
+
 ucs_status_t ucp_ep_rkey_unpack(ucp_ep_h ep, const void *rkey_buffer,
                                 ucp_rkey_h *rkey_p)
 {
     ucs_status_t status;
 
     UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(ep->worker);
-    status = ucp_ep_rkey_unpack_reachable(ep, rkey_buffer, 0, rkey_p);
+    if (ucs_unlikely(ep->flags & UCP_EP_FLAG_LAZY_WIREUP)) {
+        /* Remote key is resolved according to the endpoint lanes */
+        ucp_wireup_lazy_connect(ep);
+    }
+
+    if (ep->worker->context->config.ext.rkey_cache_size == 0) {
+        status = ucp_ep_rkey_unpack_reachable(ep, rkey_buffer, 0, rkey_p);
+    } else {
+        status = ucp_ep_rkey_unpack_cached(ep, rkey_buffer, rkey_p);
+    }
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(ep->worker);
 
     return status;
@@ -1112,26 +1384,10 @@ ucs_status_t ucp_rkey_ptr(ucp_rkey_h rkey, uint64_t raddr, void **addr_p)
 
 void ucp_rkey_destroy(ucp_rkey_h rkey)
 {
-    unsigned remote_md_index, rkey_index;
-    ucp_worker_h UCS_V_UNUSED worker;
-
-    rkey_index = 0;
-    ucs_for_each_bit(remote_md_index, rkey->md_map) {
-        if (rkey->tl_rkey[rkey_index].rkey.rkey != UCT_INVALID_RKEY) {
-            uct_rkey_release(rkey->tl_rkey[rkey_index].cmpt,
-                             &rkey->tl_rkey[rkey_index].rkey);
-        }
-        ++rkey_index;
-    }
-
-    if (rkey->flags & UCP_RKEY_DESC_FLAG_POOL) {
-        worker = ucs_container_of(ucs_mpool_obj_owner(rkey), ucp_worker_t,
-                                  rkey_mp);
-        UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
-        ucs_mpool_put_inline(rkey);
-        UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+    if (rkey->flags & UCP_RKEY_DESC_FLAG_CACHED) {
+        ucp_rkey_cache_release(rkey);
     } else {
-        ucs_free(rkey);
+        ucp_rkey_free(rkey);
     }
 }
 
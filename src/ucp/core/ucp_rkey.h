@@ -39,8 +39,10 @@ typedef struct ucp_tl_rkey {
  * Rkey flags
  */
 enum {
-    UCP_RKEY_DESC_FLAG_POOL       = UCS_BIT(0)  /* Descriptor was allocated from pool
+    UCP_RKEY_DESC_FLAG_POOL       = UCS_BIT(0), /* Descriptor was allocated from pool
                                                    and must be returned to pool, not free */
+    UCP_RKEY_DESC_FLAG_CACHED     = UCS_BIT(1)  /* Descriptor is embedded in a worker
+                                                   rkey cache entry */
 };
 
 
@@ -125,6 +127,33 @@ typedef struct ucp_rkey {
 } ucp_rkey_t;
 
 
+/**
+ * Key of the worker remote key cache: the packed rkey bytes which are consumed
+ * by unpacking, along with the endpoint configuration they were unpacked for.
+ */
+typedef struct {
+    const void             *buffer;       /* Packed remote key */
+    size_t                 length;        /* Length of the packed remote key */
+    ucp_worker_cfg_index_t ep_cfg_index;  /* Endpoint configuration index */
+} ucp_rkey_cache_key_t;
+
+
+/**
+ * Entry of the worker remote key cache. The entry holds a reference-counted
+ * remote key which is shared by all users who unpacked the same buffer.
+ */
+typedef struct {
+    ucp_worker_h                      worker;   /* Worker which owns the entry */
+    ucs_list_link_t                   list;     /* Element in the LRU list of
+                                                   unreferenced entries */
+    unsigned                          refcount; /* Number of handles returned to
+                                                   the user */
+    ucp_rkey_cache_key_t              key;      /* Cache key, the packed buffer
+                                                   follows tl_rkey array */
+    ucp_rkey_t                        rkey;     /* Must be last */
+} ucp_rkey_cache_entry_t;
+
+
 typedef struct ucp_unpacked_exported_tl_mkey {
     ucp_md_map_t   local_md_map; /* Local MD map of packed TL mkeys */
     uint8_t        tl_mkey_size; /* Size of the mkey buffer */
@@ -171,7 +200,7 @@ typedef struct ucp_unpacked_exported_memh {
 #define UCP_RKEY_RESOLVE(_rkey, _ep, _op_type) \
     ({ \
         ucs_status_t _status; \
-        if ((_rkey)->ep != (_ep)) { \
+        if (((_rkey)->ep != NULL) && ((_rkey)->ep != (_ep))) { \
             ucs_error("cannot use a remote key on a different endpoint than it was unpacked on"); \
             _status = UCS_ERR_INVALID_PARAM; \
         } else { \
@@ -246,4 +275,10 @@ void ucp_rkey_proto_select_dump(ucp_worker_h worker,
 
 ucs_sys_device_t ucp_rkey_pack_sys_dev(ucp_mem_h memh);
 
+
+void ucp_rkey_cache_init(ucp_worker_h worker);
+
+
+void ucp_rkey_cache_cleanup(ucp_worker_h worker);
+
 #endif
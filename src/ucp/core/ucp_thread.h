@@ -11,6 +11,8 @@
 #  include "config.h"
 #endif
 
+#include <ucs/arch/atomic.h>
+#include <ucs/arch/cpu.h>
 #include <ucs/async/async.h>
 #include <ucs/async/thread.h>
 #include <ucs/type/spinlock.h>
@@ -40,6 +42,89 @@ typedef struct ucp_mt_lock {
 } ucp_mt_lock_t;
 
 
+/**
+ * Flat-combining hand-off of an idempotent operation, such as progress.
+ * A thread which finds the lock busy publishes a request and spins on the
+ * combiner instead of the lock. The lock holder runs the operation once on
+ * behalf of all requests published before it started, so waiting threads do
+ * not repeat the same work after acquiring the lock one by one.
+ */
+typedef struct ucp_mt_combiner {
+    volatile uint64_t             requested; /* Number of published requests */
+    volatile uint64_t             served;    /* Requests covered by the last
+                                                completed combined run */
+    volatile unsigned             result;    /* Result of the last combined run */
+} ucp_mt_combiner_t;
+
+
+static UCS_F_ALWAYS_INLINE void ucp_mt_combiner_init(ucp_mt_combiner_t *comb)
+{
+    comb->requested = 0;
+    comb->served    = 0;
+    comb->result    = 0;
+}
+
+
+/**
+ * Publish a request to the lock holder.
+ *
+ * @return Ticket to pass to @ref ucp_mt_combiner_is_served.
+ */
+static UCS_F_ALWAYS_INLINE uint64_t
+ucp_mt_combiner_publish(ucp_mt_combiner_t *comb)
+{
+    return ucs_atomic_fadd64(&comb->requested, 1) + 1;
+}
+
+
+/**
+ * Check whether a combined run which started after the request with the given
+ * ticket was published has completed. The returned result belongs to the
+ * latest completed run, so it is only a hint for the caller.
+ */
+static UCS_F_ALWAYS_INLINE int
+ucp_mt_combiner_is_served(const ucp_mt_combiner_t *comb, uint64_t ticket,
+                          unsigned *result_p)
+{
+    if ((int64_t)(comb->served - ticket) < 0) {
+        return 0;
+    }
+
+    ucs_memory_cpu_load_fence();
+    *result_p = comb->result;
+    return 1;
+}
+
+
+/**
+ * Start a combined run; must be called with the lock held.
+ *
+ * @return Snapshot of published requests to pass to @ref ucp_mt_combiner_end.
+ */
+static UCS_F_ALWAYS_INLINE uint64_t
+ucp_mt_combiner_begin(const ucp_mt_combiner_t *comb)
+{
+    uint64_t snapshot = comb->requested;
+
+    ucs_memory_cpu_load_fence();
+    return snapshot;
+}
+
+
+/**
+ * Complete a combined run and release the threads waiting on it; must be
+ * called with the lock held.
+ */
+static UCS_F_ALWAYS_INLINE void
+ucp_mt_combiner_end(ucp_mt_combiner_t *comb, uint64_t snapshot,
+                    unsigned result)
+{
+    comb->result = result;
+    ucs_memory_cpu_store_fence();
+    comb->served = snapshot;
+}
+
+
 #define UCP_THREAD_IS_REQUIRED(_lock_ptr) \
     ((_lock_ptr)->mt_type)
 #define UCP_THREAD_LOCK_INIT(_lock_ptr) \
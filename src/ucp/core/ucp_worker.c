@@ -98,7 +98,10 @@ static ucs_stats_class_t ucp_worker_stats_class = {
         [UCP_WORKER_STAT_RNDV_GET_ZCOPY]           = "rndv_get_zcopy",
         [UCP_WORKER_STAT_RNDV_RTR]                 = "rndv_rtr",
         [UCP_WORKER_STAT_RNDV_RTR_MTYPE]           = "rndv_rtr_mtype",
-        [UCP_WORKER_STAT_RNDV_RKEY_PTR]            = "rndv_rkey_ptr"
+        [UCP_WORKER_STAT_RNDV_RKEY_PTR]            = "rndv_rkey_ptr",
+        [UCP_WORKER_STAT_RKEY_CACHE_HIT]           = "rkey_cache_hit",
+        [UCP_WORKER_STAT_RKEY_CACHE_MISS]          = "rkey_cache_miss",
+        [UCP_WORKER_STAT_RKEY_CACHE_EVICT]         = "rkey_cache_evict"
     }
 };
 #endif
@@ -2499,6 +2502,7 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
     worker->flush_ops_count      = 0;
     worker->fence_seq            = 0;
     worker->inprogress           = 0;
+    ucp_mt_combiner_init(&worker->progress_combiner);
     worker->rkey_config_count    = 0;
     worker->num_active_ifaces    = 0;
     worker->num_ifaces           = 0;
@@ -2512,6 +2516,8 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
     ucs_list_head_init(&worker->all_eps);
     ucs_list_head_init(&worker->internal_eps);
     kh_init_inplace(ucp_worker_rkey_config, &worker->rkey_config_hash);
+    ucp_rkey_cache_init(worker);
+    ucp_address_dict_init(worker);
     kh_init_inplace(ucp_worker_discard_uct_ep_hash, &worker->discard_uct_ep_hash);
     kh_init_inplace(ucp_worker_remote_flush, &worker->remote_flush_hash);
     worker->counters.ep_creations         = 0;
@@ -2541,6 +2547,9 @@ ucs_status_t ucp_worker_create(ucp_context_h context,
         uct_thread_mode = UCS_THREAD_MODE_SERIALIZED;
 #if ENABLE_MT
         worker->flags |= UCP_WORKER_FLAG_THREAD_MULTI;
+        if (context->config.ext.mt_progress_combining) {
+            worker->flags |= UCP_WORKER_FLAG_PROGRESS_COMBINING;
+        }
 #else
         ucs_diag("multi-threaded worker is requested, but library is built "
                  "without multi-thread support");
@@ -2725,6 +2734,8 @@ err_free:
                        &worker->discard_uct_ep_hash);
     kh_destroy_inplace(ucp_worker_rkey_config, &worker->rkey_config_hash);
     kh_destroy_inplace(ucp_worker_remote_flush, &worker->remote_flush_hash);
+    ucp_rkey_cache_cleanup(worker);
+    ucp_address_dict_cleanup(worker);
     ucp_worker_destroy_configs(worker);
     ucs_free(worker);
     return status;
@@ -2960,6 +2971,8 @@ void ucp_worker_destroy(ucp_worker_h worker)
 
     ucs_vfs_obj_remove(worker);
     ucp_tag_match_cleanup(&worker->tm);
+    ucp_rkey_cache_cleanup(worker);
+    ucp_address_dict_cleanup(worker);
     ucp_worker_destroy_mpools(worker);
     ucp_worker_close_cms(worker);
     ucp_worker_close_ifaces(worker);
@@ -2980,6 +2993,26 @@ void ucp_worker_destroy(ucp_worker_h worker)
     ucs_free(worker);
 }
 
+static void ucp_worker_address_tl_bitmap(ucp_worker_h worker,
+                                         uint32_t address_flags,
+                                         ucp_tl_bitmap_t *tl_bitmap)
+{
+    ucp_rsc_index_t tl_id;
+    const uct_iface_attr_t *iface_attr;
+
+    if (address_flags & UCP_WORKER_ADDRESS_FLAG_NET_ONLY) {
+        UCS_STATIC_BITMAP_RESET_ALL(tl_bitmap);
+        UCS_STATIC_BITMAP_FOR_EACH_BIT(tl_id, &worker->context->tl_bitmap) {
+            iface_attr = ucp_worker_iface_get_attr(worker, tl_id);
+            if (iface_attr->cap.flags & UCT_IFACE_FLAG_INTER_NODE) {
+                UCS_STATIC_BITMAP_SET(tl_bitmap, tl_id);
+            }
+        }
+    } else {
+        UCS_STATIC_BITMAP_SET_ALL(tl_bitmap);
+    }
+}
+
 static ucs_status_t ucp_worker_address_pack(ucp_worker_h worker,
                                             uint32_t address_flags,
                                             size_t *address_length_p,
@@ -2988,8 +3021,6 @@ static ucs_status_t ucp_worker_address_pack(ucp_worker_h worker,
     ucp_context_h context = worker->context;
     unsigned flags        = ucp_worker_default_address_pack_flags(worker);
     ucp_tl_bitmap_t tl_bitmap;
-    ucp_rsc_index_t tl_id;
-    const uct_iface_attr_t *iface_attr;
 
     /* Make sure that UUID is packed to the address intended for the user,
      * because ucp_worker_address_query routine assumes that uuid is always
@@ -2997,16 +3028,11 @@ static ucs_status_t ucp_worker_address_pack(ucp_worker_h worker,
      */
     ucs_assert(flags & UCP_ADDRESS_PACK_FLAG_WORKER_UUID);
 
-    if (address_flags & UCP_WORKER_ADDRESS_FLAG_NET_ONLY) {
-        UCS_STATIC_BITMAP_RESET_ALL(&tl_bitmap);
-        UCS_STATIC_BITMAP_FOR_EACH_BIT(tl_id, &worker->context->tl_bitmap) {
-            iface_attr = ucp_worker_iface_get_attr(worker, tl_id);
-            if (iface_attr->cap.flags & UCT_IFACE_FLAG_INTER_NODE) {
-                UCS_STATIC_BITMAP_SET(&tl_bitmap, tl_id);
-            }
-        }
-    } else {
-        UCS_STATIC_BITMAP_SET_ALL(&tl_bitmap);
+    ucp_worker_address_tl_bitmap(worker, address_flags, &tl_bitmap);
+
+    if (address_flags & UCP_WORKER_ADDRESS_FLAG_COMPACT) {
+        return ucp_address_pack_compact(worker, &tl_bitmap, flags,
+                                        address_length_p, address_p);
     }
 
     return ucp_address_pack(worker, NULL, &tl_bitmap, flags,
@@ -3019,6 +3045,7 @@ ucs_status_t ucp_worker_query(ucp_worker_h worker,
 {
     ucs_status_t status = UCS_OK;
     uint32_t address_flags;
+    ucp_tl_bitmap_t tl_bitmap;
 
     if (attr->field_mask & UCP_WORKER_ATTR_FIELD_THREAD_MODE) {
         attr->thread_mode = ucp_worker_get_thread_mode(worker->flags);
@@ -3032,6 +3059,21 @@ ucs_status_t ucp_worker_query(ucp_worker_h worker,
                                                 (void**)&attr->address);
     }
 
+    if ((status == UCS_OK) &&
+        (attr->field_mask & UCP_WORKER_ATTR_FIELD_ADDRESS_DICT)) {
+        address_flags = UCP_ATTR_VALUE(WORKER, attr, address_flags,
+                                       ADDRESS_FLAGS, 0);
+        ucp_worker_address_tl_bitmap(worker, address_flags, &tl_bitmap);
+        status        = ucp_address_pack_dict(
+                worker, &tl_bitmap,
+                ucp_worker_default_address_pack_flags(worker),
+                &attr->address_dict_length, (void**)&attr->address_dict);
+        if ((status != UCS_OK) &&
+            (attr->field_mask & UCP_WORKER_ATTR_FIELD_ADDRESS)) {
+            ucp_worker_release_address(worker, attr->address);
+        }
+    }
+
     if (attr->field_mask & UCP_WORKER_ATTR_FIELD_MAX_AM_HEADER) {
         attr->max_am_header = worker->max_am_header;
     }
@@ -3057,16 +3099,15 @@ ucs_status_t ucp_worker_address_query(ucp_address_t *address,
     return UCS_OK;
 }
 
-unsigned ucp_worker_progress(ucp_worker_h worker)
+static UCS_F_ALWAYS_INLINE unsigned
+ucp_worker_progress_locked(ucp_worker_h worker)
 {
     unsigned count;
 
-    /* worker->inprogress is used only for assertion check.
+    /* check that ucp_worker_progress is not called from within ucp_worker_progress.
+     * worker->inprogress is used only for assertion check.
      * coverity[assert_side_effect]
      */
-    UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
-
-    /* check that ucp_worker_progress is not called from within ucp_worker_progress */
     ucs_assert(worker->inprogress++ == 0);
     count = uct_worker_progress(worker->uct);
     ucs_async_check_miss(&worker->async);
@@ -3074,6 +3115,48 @@ unsigned ucp_worker_progress(ucp_worker_h worker)
     /* coverity[assert_side_effect] */
     ucs_assert(--worker->inprogress == 0);
 
+    return count;
+}
+
+static UCS_F_NOINLINE unsigned
+ucp_worker_progress_combining(ucp_worker_h worker)
+{
+    ucp_mt_combiner_t *comb = &worker->progress_combiner;
+    uint64_t ticket, snapshot;
+    unsigned count;
+
+    if (!ucs_async_try_block(&worker->async)) {
+        /* Another thread holds the worker lock: publish a progress request and
+         * wait until either the lock holder serves it, or the lock is free */
+        ticket = ucp_mt_combiner_publish(comb);
+        while (!ucs_async_try_block(&worker->async)) {
+            if (ucp_mt_combiner_is_served(comb, ticket, &count)) {
+                return count;
+            }
+
+            ucs_cpu_relax();
+        }
+    }
+
+    snapshot = ucp_mt_combiner_begin(comb);
+    count    = ucp_worker_progress_locked(worker);
+    ucp_mt_combiner_end(comb, snapshot, count);
+
+    UCS_ASYNC_UNBLOCK(&worker->async);
+
+    return count;
+}
+
+unsigned ucp_worker_progress(ucp_worker_h worker)
+{
+    unsigned count;
+
+    if (ucs_unlikely(worker->flags & UCP_WORKER_FLAG_PROGRESS_COMBINING)) {
+        return ucp_worker_progress_combining(worker);
+    }
+
+    UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+    count = ucp_worker_progress_locked(worker);
     UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
 
     return count;
@@ -3316,6 +3399,19 @@ void ucp_worker_release_address(ucp_worker_h worker, ucp_address_t *address)
     ucs_free(address);
 }
 
+ucs_status_t ucp_worker_address_dict_import(ucp_worker_h worker,
+                                            const ucp_address_t *dict,
+                                            size_t dict_length)
+{
+    ucs_status_t status;
+
+    UCP_WORKER_THREAD_CS_ENTER_CONDITIONAL(worker);
+    status = ucp_address_dict_import(worker, dict, dict_length);
+    UCP_WORKER_THREAD_CS_EXIT_CONDITIONAL(worker);
+
+    return status;
+}
+
 void ucp_worker_print_info(ucp_worker_h worker, FILE *stream)
 {
     ucp_context_h context = worker->context;
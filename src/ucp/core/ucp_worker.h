@@ -110,7 +110,12 @@ enum {
 
     /** Indicates that UCT EP discarding was disabled on this worker */
     UCP_WORKER_FLAG_DISCARD_DISABLED =
-            UCS_BIT(UCP_WORKER_INTERNAL_FLAGS_SHIFT + 5)
+            UCS_BIT(UCP_WORKER_INTERNAL_FLAGS_SHIFT + 5),
+
+    /** Progress calls from multiple threads are combined by the lock holder.
+        Set only together with UCP_WORKER_FLAG_THREAD_MULTI. */
+    UCP_WORKER_FLAG_PROGRESS_COMBINING =
+            UCS_BIT(UCP_WORKER_INTERNAL_FLAGS_SHIFT + 6)
 };
 
 
@@ -155,6 +160,11 @@ enum {
     UCP_WORKER_STAT_RNDV_RTR_MTYPE,
     UCP_WORKER_STAT_RNDV_RKEY_PTR,
 
+    /* Lookups in the remote key cache of ucp_ep_rkey_unpack() */
+    UCP_WORKER_STAT_RKEY_CACHE_HIT,
+    UCP_WORKER_STAT_RKEY_CACHE_MISS,
+    UCP_WORKER_STAT_RKEY_CACHE_EVICT,
+
     UCP_WORKER_STAT_LAST
 };
 
@@ -213,6 +223,17 @@ KHASH_TYPE(ucp_worker_rkey_config, ucp_rkey_config_key_t, ucp_worker_cfg_index_t
 typedef khash_t(ucp_worker_rkey_config) ucp_worker_rkey_config_hash_t;
 
 
+/* Hash map to find unpacked remote key by packed rkey buffer */
+KHASH_TYPE(ucp_worker_rkey_cache, ucp_rkey_cache_key_t,
+           ucp_rkey_cache_entry_t*);
+typedef khash_t(ucp_worker_rkey_cache) ucp_worker_rkey_cache_hash_t;
+
+
+/* Hash map to find imported address dictionary by its id */
+KHASH_TYPE(ucp_worker_address_dict, uint64_t, ucp_address_dict_t*);
+typedef khash_t(ucp_worker_address_dict) ucp_worker_address_dict_hash_t;
+
+
 /* Hash map of UCT EPs that are being discarded on UCP Worker */
 KHASH_TYPE(ucp_worker_discard_uct_ep_hash, uct_ep_h, ucp_request_t*);
 typedef khash_t(ucp_worker_discard_uct_ep_hash) ucp_worker_discard_uct_ep_hash_t;
@@ -307,6 +328,8 @@ typedef struct ucp_worker {
     ucp_tl_bitmap_t                  atomic_tls;          /* Which resources can be used for atomics */
 
     int                              inprogress;
+    ucp_mt_combiner_t                progress_combiner;   /* Progress hand-off
+                                                             between threads */
     /* Worker name for tracing and analysis */
     char                             name[UCP_ENTITY_NAME_MAX];
     /* Worker address name composed of host name and process id */
@@ -370,6 +393,17 @@ typedef struct ucp_worker {
     unsigned                         rkey_config_count;   /* Current number of rkey configurations */
     ucp_rkey_config_t                rkey_config[UCP_WORKER_MAX_RKEY_CONFIG];
 
+    struct {
+        ucp_worker_rkey_cache_hash_t hash;                /* Packed rkey -> entry */
+        ucs_list_link_t              lru;                 /* Unreferenced entries,
+                                                             least recently used
+                                                             first */
+        unsigned                     count;               /* Number of entries */
+    } rkey_cache;
+
+    ucp_worker_address_dict_hash_t   address_dict_hash;   /* Imported address
+                                                             dictionaries */
+
     struct {
         int                          timerfd;             /* Timer needed to signal to user's fd when
                                                            * the next keepalive round must be done */
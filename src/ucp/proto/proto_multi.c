@@ -370,6 +370,7 @@ ucs_status_t ucp_proto_multi_init(const ucp_proto_multi_init_params_t *params,
     mpriv->min_frag     = 0;
     mpriv->max_frag_sum = 0;
     mpriv->align_thresh = 1;
+    mpriv->flags        = 0;
     perf.max_frag       = 0;
     perf.min_length     = 0;
     weight_sum          = 0;
@@ -461,6 +462,11 @@ ucs_status_t ucp_proto_multi_init(const ucp_proto_multi_init_params_t *params,
     }
     ucs_assert(mpriv->num_lanes == ucs_popcount(selection.lane_map));
 
+    if ((mpriv->num_lanes > 1) &&
+        params->super.super.worker->context->config.ext.multi_lane_steal) {
+        mpriv->flags |= UCP_PROTO_MULTI_FLAG_STEAL;
+    }
+
     /* After this block, 'perf_node' and 'lane_perf_nodes[]' have extra ref */
     if (mpriv->num_lanes == 1) {
         perf_node = lanes_perf_nodes[ucs_ffs64(selection.lane_map)];
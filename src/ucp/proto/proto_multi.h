@@ -45,6 +45,16 @@
     })
 
 
+/**
+ * Multi-lane protocol flags
+ */
+enum {
+    /* A fragment may be sent on another lane when the current lane has no send
+     * resources, to avoid waiting for a congested or slower lane */
+    UCP_PROTO_MULTI_FLAG_STEAL = UCS_BIT(0)
+};
+
+
 /**
  * UCP base protocol definition for multi-fragment protocols
  */
@@ -99,6 +109,7 @@ typedef struct {
     size_t                      max_frag_sum; /* 'max_frag' sum of all lanes */
     ucp_lane_map_t              lane_map;     /* Map of used lanes */
     ucp_lane_index_t            num_lanes;    /* Number of lanes to use */
+    uint8_t                     flags;        /* UCP_PROTO_MULTI_FLAG_xx */
     size_t                      align_thresh; /* Cached value of threshold for
                                                  enabling data split alignment */
     ucp_proto_multi_lane_priv_t lanes[UCP_MAX_LANES]; /* Array of lanes */
@@ -159,6 +159,46 @@ ucp_proto_multi_advance_lane_idx(ucp_request_t *req, ucp_lane_index_t num_lanes,
     req->send.multi_lane_idx = lane_idx;
 }
 
+static UCS_F_ALWAYS_INLINE ucs_status_t
+ucp_proto_multi_send(ucp_request_t *req, const ucp_proto_multi_priv_t *mpriv,
+                     ucp_proto_send_multi_cb_t send_func,
+                     ucp_datatype_iter_t *next_iter,
+                     ucp_lane_index_t *lane_shift)
+{
+    ucp_lane_index_t lane_idx = req->send.multi_lane_idx;
+    ucp_lane_index_t count;
+    ucs_status_t status;
+
+    status = send_func(req, &mpriv->lanes[lane_idx], next_iter, lane_shift);
+    if (ucs_likely(status != UCS_ERR_NO_RESOURCE) ||
+        !(mpriv->flags & UCP_PROTO_MULTI_FLAG_STEAL) ||
+        (req->send.state.dt_iter.offset == 0)) {
+        return status;
+    }
+
+    /* The lane is congested, so pass the fragment to the next lane which has
+     * send resources. The first fragment is never moved, since it may require
+     * capabilities of the first lane. */
+    for (count = 1; count < mpriv->num_lanes; ++count) {
+        if (++lane_idx == mpriv->num_lanes) {
+            lane_idx = 0;
+        }
+
+        *lane_shift = 1;
+        status      = send_func(req, &mpriv->lanes[lane_idx], next_iter,
+                                lane_shift);
+        if (status != UCS_ERR_NO_RESOURCE) {
+            ucp_trace_req(req, "lane[%d] has no resources, using lane[%d]",
+                          mpriv->lanes[req->send.multi_lane_idx].super.lane,
+                          mpriv->lanes[lane_idx].super.lane);
+            req->send.multi_lane_idx = lane_idx;
+            break;
+        }
+    }
+
+    return status;
+}
+
 static UCS_F_ALWAYS_INLINE ucs_status_t
 ucp_proto_multi_progress(ucp_request_t *req,
                          const ucp_proto_multi_priv_t *mpriv,
@@ -169,24 +209,22 @@ ucp_proto_multi_progress(ucp_request_t *req,
     ucp_lane_index_t lane_shift = 1;
     const ucp_proto_multi_lane_priv_t *lpriv;
     ucp_datatype_iter_t next_iter;
-    ucp_lane_index_t lane_idx;
     ucs_status_t status;
 
     ucs_assertv(req->send.multi_lane_idx < mpriv->num_lanes,
                 "lane_idx=%d num_lanes=%d", req->send.multi_lane_idx,
                 mpriv->num_lanes);
 
-    lane_idx = req->send.multi_lane_idx;
-    lpriv    = &mpriv->lanes[lane_idx];
-
     /* send the next fragment */
-    status = send_func(req, lpriv, &next_iter, &lane_shift);
+    status = ucp_proto_multi_send(req, mpriv, send_func, &next_iter,
+                                  &lane_shift);
     if (ucs_likely(status == UCS_OK)) {
         /* fast path is OK */
     } else if (status == UCS_INPROGRESS) {
         /* operation started and completion will be called later */
         ++req->send.state.uct_comp.count;
     } else {
+        lpriv = &mpriv->lanes[req->send.multi_lane_idx];
         return ucp_proto_multi_handle_send_error(req, lpriv->super.lane,
                                                  status);
     }
@@ -641,6 +641,10 @@ ucp_proto_rndv_bulk_init(const ucp_proto_multi_init_params_t *init_params,
     mpriv->align_thresh = ucs_max(rndv_align_thresh,
                                   mpriv->align_thresh + mpriv->min_frag);
 
+    /* The lane of each fragment is derived from its offset, see
+     * ucp_proto_rndv_bulk_max_payload() */
+    mpriv->flags       &= ~UCP_PROTO_MULTI_FLAG_STEAL;
+
     status = ucp_proto_rndv_ack_init(&init_params->super, ack_name, 50e-9,
                                      &ack_perf, &rpriv->super);
     if (status != UCS_OK) {
@@ -829,6 +833,7 @@ UCS_PROFILE_FUNC_VOID(ucp_proto_rndv_receive_start,
     req->send.rndv.remote_req_id  = rts->sreq.req_id;
     req->send.rndv.remote_address = rts->address;
     req->send.rndv.offset         = 0;
+    req->send.rndv.reg_chunks     = NULL;
     ucp_request_set_super(req, recv_req);
 
     if (ucs_likely(rts->size <= recv_req->recv.dt_iter.length)) {
@@ -880,6 +885,7 @@ UCS_PROFILE_FUNC(ucs_status_t, ucp_proto_rndv_send_start,
     req->send.rndv.remote_address = rtr->address;
     req->send.rndv.remote_req_id  = rtr->rreq_id;
     req->send.rndv.offset         = rtr->offset;
+    req->send.rndv.reg_chunks     = NULL;
 
     ucs_assert(rtr->size == req->send.state.dt_iter.length);
     status = ucp_proto_rndv_send_reply(worker, req, UCP_OP_ID_RNDV_SEND,
@@ -992,6 +998,132 @@ err_request_fail:
     return UCS_OK;
 }
 
+static size_t ucp_proto_rndv_bulk_reg_chunk_size(ucp_context_h context)
+{
+    return ucs_align_up_pow2(context->config.ext.rndv_reg_chunk_size,
+                             ucs_get_page_size());
+}
+
+ucs_status_t
+ucp_proto_rndv_bulk_reg_next(ucp_request_t *req,
+                             const ucp_proto_rndv_bulk_priv_t *rpriv,
+                             unsigned uct_mem_flags)
+{
+    ucp_context_h context        = req->send.ep->worker->context;
+    ucp_datatype_iter_t *dt_iter = &req->send.state.dt_iter;
+    size_t chunk_size            = ucp_proto_rndv_bulk_reg_chunk_size(context);
+    ucp_proto_rndv_reg_chunks_t *chunks;
+    uintptr_t address, end, chunk_end;
+    ucs_status_t status;
+    ucp_mem_h memh;
+
+    /* Chunk boundaries are aligned to the chunk size, so chunks registered by
+     * different requests for the same buffer do not overlap */
+    address   = (uintptr_t)UCS_PTR_BYTE_OFFSET(dt_iter->type.contig.buffer,
+                                               dt_iter->offset);
+    end       = (uintptr_t)UCS_PTR_BYTE_OFFSET(dt_iter->type.contig.buffer,
+                                               dt_iter->length);
+    chunk_end = ucs_min(ucs_align_down(address, chunk_size) + chunk_size, end);
+
+    status = ucp_memh_get(context, (void*)address, chunk_end - address,
+                          (ucs_memory_type_t)dt_iter->mem_info.type,
+                          rpriv->mpriv.reg_md_map, uct_mem_flags,
+                          "rndv_reg_chunk", &memh);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    ucp_trace_req(req, "registered chunk 0x%lx..0x%lx: memh %p [%p..%p]",
+                  address, chunk_end, memh, ucp_memh_address(memh),
+                  UCS_PTR_BYTE_OFFSET(ucp_memh_address(memh),
+                                      ucp_memh_length(memh)));
+
+    /* The previous chunk may still be in use by outstanding operations, so it
+     * is released only when the request completes */
+    if (dt_iter->type.contig.memh != NULL) {
+        chunks                         = req->send.rndv.reg_chunks;
+        chunks->memhs[chunks->count++] = dt_iter->type.contig.memh;
+    }
+
+    dt_iter->type.contig.memh = memh;
+    return UCS_OK;
+}
+
+ucs_status_t
+ucp_proto_rndv_bulk_reg_start(ucp_request_t *req,
+                              const ucp_proto_rndv_bulk_priv_t *rpriv,
+                              unsigned uct_mem_flags)
+{
+    ucp_context_h context        = req->send.ep->worker->context;
+    ucp_datatype_iter_t *dt_iter = &req->send.state.dt_iter;
+    size_t chunk_size            = ucp_proto_rndv_bulk_reg_chunk_size(context);
+    ucp_proto_rndv_reg_chunks_t *chunks;
+    uintptr_t start, end;
+    ucs_status_t status;
+    size_t max_chunks;
+
+    /* Fragments must not cross chunk boundaries, so the buffer is not chunked
+     * if a fragment may be extended backwards to satisfy minimal size */
+    if ((dt_iter->dt_class != UCP_DATATYPE_CONTIG) ||
+        (dt_iter->type.contig.memh != NULL) ||
+        (rpriv->mpriv.reg_md_map == 0) || (rpriv->mpriv.min_frag > 0)) {
+        return UCS_OK;
+    }
+
+    start      = (uintptr_t)UCS_PTR_BYTE_OFFSET(dt_iter->type.contig.buffer,
+                                                dt_iter->offset);
+    end        = (uintptr_t)UCS_PTR_BYTE_OFFSET(dt_iter->type.contig.buffer,
+                                                dt_iter->length);
+    max_chunks = (ucs_align_up(end, chunk_size) -
+                  ucs_align_down(start, chunk_size)) / chunk_size;
+    if (max_chunks <= 1) {
+        return UCS_OK;
+    }
+
+    /* The current chunk is kept in the datatype iterator */
+    chunks = ucs_malloc(sizeof(*chunks) + ((max_chunks - 1) * sizeof(ucp_mem_h)),
+                        "rndv_reg_chunks");
+    if (chunks == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    chunks->count            = 0;
+    req->send.rndv.reg_chunks = chunks;
+
+    status = ucp_proto_rndv_bulk_reg_next(req, rpriv, uct_mem_flags);
+    if ((status != UCS_OK) ||
+        ucp_memh_is_buffer_in_range(dt_iter->type.contig.memh, (void*)start,
+                                    end - start)) {
+        /* Failed, or the whole buffer is already registered */
+        ucs_free(chunks);
+        req->send.rndv.reg_chunks = NULL;
+        return status;
+    }
+
+    ucp_trace_req(req, "registering %zu bytes in up to %zu chunks",
+                  end - start, max_chunks);
+    return UCS_OK;
+}
+
+void ucp_proto_rndv_bulk_reg_cleanup(ucp_request_t *req)
+{
+    ucp_proto_rndv_reg_chunks_t *chunks = req->send.rndv.reg_chunks;
+    unsigned i;
+
+    if (chunks == NULL) {
+        return;
+    }
+
+    for (i = 0; i < chunks->count; ++i) {
+        ucp_memh_put(chunks->memhs[i]);
+    }
+
+    ucp_datatype_iter_mem_dereg(&req->send.state.dt_iter,
+                                UCS_BIT(UCP_DATATYPE_CONTIG));
+    ucs_free(chunks);
+    req->send.rndv.reg_chunks = NULL;
+}
+
 void ucp_proto_rndv_bulk_request_init_lane_idx(
         ucp_request_t *req, const ucp_proto_rndv_bulk_priv_t *rpriv)
 {
@@ -62,6 +62,16 @@ typedef struct {
 } ucp_proto_rndv_ack_priv_t;
 
 
+/*
+ * Chunks of the local buffer of a bulk transfer, which are released when the
+ * transfer is completed
+ */
+struct ucp_proto_rndv_reg_chunks {
+    unsigned  count;    /* Number of chunks in the array */
+    ucp_mem_h memhs[0]; /* Registered chunks, except the current one */
+};
+
+
 /*
  * Private data for rendezvous protocol which sends bulk data followed by an
  * acknowledgement packet
@@ -210,6 +220,24 @@ ucs_status_t ucp_proto_rndv_handle_data(void *arg, void *data, size_t length,
                                         unsigned flags);
 
 
+/* Start registering the local buffer of a bulk transfer in chunks */
+ucs_status_t
+ucp_proto_rndv_bulk_reg_start(ucp_request_t *req,
+                              const ucp_proto_rndv_bulk_priv_t *rpriv,
+                              unsigned uct_mem_flags);
+
+
+/* Register the chunk which starts at the current position of the request */
+ucs_status_t
+ucp_proto_rndv_bulk_reg_next(ucp_request_t *req,
+                             const ucp_proto_rndv_bulk_priv_t *rpriv,
+                             unsigned uct_mem_flags);
+
+
+/* Release all the chunks registered by the request */
+void ucp_proto_rndv_bulk_reg_cleanup(ucp_request_t *req);
+
+
 /* Initialize req->send.multi_lane_idx according to req->rndv.offset */
 void ucp_proto_rndv_bulk_request_init_lane_idx(
         ucp_request_t *req, const ucp_proto_rndv_bulk_priv_t *rpriv);
@@ -233,6 +233,93 @@ ucp_proto_rndv_bulk_request_init(ucp_request_t *req,
     return UCS_OK;
 }
 
+/**
+ * Make sure the current position of a chunked bulk transfer is covered by a
+ * registered chunk.
+ */
+static UCS_F_ALWAYS_INLINE ucs_status_t
+ucp_proto_rndv_bulk_reg_advance(ucp_request_t *req,
+                                const ucp_proto_rndv_bulk_priv_t *rpriv,
+                                unsigned uct_mem_flags)
+{
+    ucp_datatype_iter_t *dt_iter = &req->send.state.dt_iter;
+
+    if (ucp_memh_is_buffer_in_range(dt_iter->type.contig.memh,
+                                    UCS_PTR_BYTE_OFFSET(
+                                            dt_iter->type.contig.buffer,
+                                            dt_iter->offset),
+                                    1)) {
+        return UCS_OK;
+    }
+
+    return ucp_proto_rndv_bulk_reg_next(req, rpriv, uct_mem_flags);
+}
+
+/**
+ * Progress a zero-copy bulk transfer, which registers the local buffer in
+ * chunks if it is larger than the configured chunk size.
+ */
+static UCS_F_ALWAYS_INLINE ucs_status_t ucp_proto_rndv_bulk_zcopy_progress(
+        ucp_request_t *req, const ucp_proto_rndv_bulk_priv_t *rpriv,
+        ucp_proto_init_cb_t init_func, unsigned uct_mem_flags,
+        ucp_proto_send_multi_cb_t send_func,
+        ucp_proto_complete_cb_t complete_func,
+        uct_completion_callback_t uct_comp_cb)
+{
+    ucp_context_h context = req->send.ep->worker->context;
+    ucs_status_t status;
+
+    if (!(req->flags & UCP_REQUEST_FLAG_PROTO_INITIALIZED)) {
+        if (ucs_unlikely(req->send.state.dt_iter.length >
+                         context->config.ext.rndv_reg_chunk_size)) {
+            ucp_proto_completion_init(&req->send.state.uct_comp, uct_comp_cb);
+            status = ucp_proto_rndv_bulk_reg_start(req, rpriv, uct_mem_flags);
+            if (status != UCS_OK) {
+                goto err_abort;
+            }
+        }
+    } else if (ucs_unlikely(req->send.rndv.reg_chunks != NULL)) {
+        /* Register the next chunk while the previous one is transferred */
+        status = ucp_proto_rndv_bulk_reg_advance(req, rpriv, uct_mem_flags);
+        if (status != UCS_OK) {
+            goto err_abort;
+        }
+    }
+
+    return ucp_proto_multi_zcopy_progress(req, &rpriv->mpriv, init_func,
+                                          uct_mem_flags,
+                                          UCS_BIT(UCP_DATATYPE_CONTIG),
+                                          send_func, complete_func,
+                                          uct_comp_cb);
+
+err_abort:
+    ucp_proto_request_abort(req, status);
+    return UCS_OK; /* remove from pending after request is completed */
+}
+
+/**
+ * Limit the payload of a chunked bulk transfer to the end of the current
+ * registered chunk.
+ */
+static UCS_F_ALWAYS_INLINE size_t
+ucp_proto_rndv_bulk_reg_max_payload(ucp_request_t *req, size_t max_payload)
+{
+    ucp_datatype_iter_t *dt_iter = &req->send.state.dt_iter;
+    ucp_mem_h memh               = dt_iter->type.contig.memh;
+
+    if (ucs_likely(req->send.rndv.reg_chunks == NULL)) {
+        return max_payload;
+    }
+
+    return ucs_min(max_payload,
+                   UCS_PTR_BYTE_DIFF(UCS_PTR_BYTE_OFFSET(
+                                             dt_iter->type.contig.buffer,
+                                             dt_iter->offset),
+                                     UCS_PTR_BYTE_OFFSET(
+                                             ucp_memh_address(memh),
+                                             ucp_memh_length(memh))));
+}
+
 /**
  * Calculate how much data to send on the next lane in a rendezvous protocol,
  * including when the request is a fragment and starts from nonzero offset.
@@ -103,6 +103,7 @@ ucp_proto_rndv_get_zcopy_fetch_completion(uct_completion_t *uct_comp)
     ucp_request_t *req = ucs_container_of(uct_comp, ucp_request_t,
                                           send.state.uct_comp);
 
+    ucp_proto_rndv_bulk_reg_cleanup(req);
     ucp_datatype_iter_mem_dereg(&req->send.state.dt_iter,
                                 UCS_BIT(UCP_DATATYPE_CONTIG));
     if (ucs_unlikely(uct_comp->status != UCS_OK)) {
@@ -153,6 +154,7 @@ ucp_proto_rndv_get_zcopy_send_func(ucp_request_t *req,
 
     max_payload = ucp_proto_rndv_bulk_max_payload_align(req, rpriv, lpriv,
                                                         lane_shift);
+    max_payload = ucp_proto_rndv_bulk_reg_max_payload(req, max_payload);
     ucp_datatype_iter_next_iov(&req->send.state.dt_iter, max_payload,
                                lpriv->super.md_index,
                                UCS_BIT(UCP_DATATYPE_CONTIG), next_iter, &iov,
@@ -174,10 +176,9 @@ ucp_proto_rndv_get_zcopy_fetch_progress(uct_pending_req_t *uct_req)
     /* coverity[tainted_data_downcast] */
     const ucp_proto_rndv_bulk_priv_t *rpriv = req->send.proto_config->priv;
 
-    return ucp_proto_multi_zcopy_progress(
-            req, &rpriv->mpriv, ucp_proto_rndv_get_common_request_init,
-            UCT_MD_MEM_ACCESS_LOCAL_WRITE, UCS_BIT(UCP_DATATYPE_CONTIG),
-            ucp_proto_rndv_get_zcopy_send_func,
+    return ucp_proto_rndv_bulk_zcopy_progress(
+            req, rpriv, ucp_proto_rndv_get_common_request_init,
+            UCT_MD_MEM_ACCESS_LOCAL_WRITE, ucp_proto_rndv_get_zcopy_send_func,
             ucp_request_invoke_uct_completion_success,
             ucp_proto_rndv_get_zcopy_fetch_completion);
 }
@@ -212,6 +213,7 @@ static ucs_status_t ucp_rndv_get_zcopy_proto_reset(ucp_request_t *req)
 
     switch (req->send.proto_stage) {
     case UCP_PROTO_RNDV_GET_STAGE_FETCH:
+        ucp_proto_rndv_bulk_reg_cleanup(req);
         ucp_datatype_iter_mem_dereg(&req->send.state.dt_iter, UCP_DT_MASK_ALL);
         /* Fall through */
     case UCP_PROTO_RNDV_GET_STAGE_ATS:
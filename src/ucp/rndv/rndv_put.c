@@ -54,6 +54,7 @@ static void ucp_proto_rndv_put_zcopy_completion(uct_completion_t *uct_comp)
 {
     ucp_request_t *req = ucs_container_of(uct_comp, ucp_request_t,
                                           send.state.uct_comp);
+    ucp_proto_rndv_bulk_reg_cleanup(req);
     ucp_proto_rndv_put_common_complete(req);
 }
 
@@ -82,7 +83,8 @@ ucp_proto_rndv_put_common_flush_completion_send_atp(uct_completion_t *uct_comp)
                   ucs_status_string(uct_comp->status));
 
     if (ucs_unlikely(uct_comp->status != UCS_OK)) {
-        ucp_proto_rndv_put_common_complete(req);
+        /* Release protocol-specific resources as well */
+        rpriv->atp_comp_cb(uct_comp);
         return;
     }
 
@@ -400,6 +402,7 @@ static UCS_F_ALWAYS_INLINE ucs_status_t ucp_proto_rndv_put_zcopy_send_func(
 
     max_payload = ucp_proto_rndv_bulk_max_payload_align(req, &rpriv->bulk,
                                                         lpriv, lane_shift);
+    max_payload = ucp_proto_rndv_bulk_reg_max_payload(req, max_payload);
     ucp_datatype_iter_next_iov(&req->send.state.dt_iter, max_payload,
                                lpriv->super.md_index,
                                UCS_BIT(UCP_DATATYPE_CONTIG), next_iter, &iov,
@@ -414,10 +417,9 @@ ucp_proto_rndv_put_zcopy_send_progress(uct_pending_req_t *uct_req)
     ucp_request_t *req = ucs_container_of(uct_req, ucp_request_t, send.uct);
     const ucp_proto_rndv_put_priv_t *rpriv = req->send.proto_config->priv;
 
-    return ucp_proto_multi_zcopy_progress(
-            req, &rpriv->bulk.mpriv, ucp_proto_rndv_put_common_request_init,
-            UCT_MD_MEM_ACCESS_LOCAL_READ, UCS_BIT(UCP_DATATYPE_CONTIG),
-            ucp_proto_rndv_put_zcopy_send_func,
+    return ucp_proto_rndv_bulk_zcopy_progress(
+            req, &rpriv->bulk, ucp_proto_rndv_put_common_request_init,
+            UCT_MD_MEM_ACCESS_LOCAL_READ, ucp_proto_rndv_put_zcopy_send_func,
             ucp_proto_rndv_put_common_data_sent, rpriv->put_comp_cb);
 }
 
@@ -467,6 +469,8 @@ static ucs_status_t ucp_proto_rndv_put_zcopy_reset(ucp_request_t *req)
                                UCS_BIT(UCP_DATATYPE_CONTIG));
     }
 
+    /* Chunks are registered again from the current position */
+    ucp_proto_rndv_bulk_reg_cleanup(req);
     req->flags &= ~UCP_REQUEST_FLAG_PROTO_INITIALIZED;
     return UCS_OK;
 }
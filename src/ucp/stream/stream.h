@@ -34,7 +34,7 @@ void ucp_stream_ep_activate(ucp_ep_h ep);
 
 static UCS_F_ALWAYS_INLINE int ucp_stream_ep_is_queued(ucp_ep_ext_t *ep_ext)
 {
-    return ep_ext->stream.ready_list.next != NULL;
+    return ep_ext->stream->ready_list.next != NULL;
 }
 
 static UCS_F_ALWAYS_INLINE int ucp_stream_ep_has_data(ucp_ep_ext_t *ep_ext)
@@ -46,22 +46,23 @@ static UCS_F_ALWAYS_INLINE
 void ucp_stream_ep_enqueue(ucp_ep_ext_t *ep_ext, ucp_worker_h worker)
 {
     ucs_assert(!ucp_stream_ep_is_queued(ep_ext));
-    ucs_list_add_tail(&worker->stream_ready_eps, &ep_ext->stream.ready_list);
+    ucs_list_add_tail(&worker->stream_ready_eps, &ep_ext->stream->ready_list);
 }
 
 static UCS_F_ALWAYS_INLINE void ucp_stream_ep_dequeue(ucp_ep_ext_t *ep_ext)
 {
-    ucs_list_del(&ep_ext->stream.ready_list);
-    ep_ext->stream.ready_list.next = NULL;
+    ucs_list_del(&ep_ext->stream->ready_list);
+    ep_ext->stream->ready_list.next = NULL;
 }
 
 static UCS_F_ALWAYS_INLINE ucp_ep_ext_t *
 ucp_stream_worker_dequeue_ep_head(ucp_worker_h worker)
 {
     ucp_ep_ext_t *ep_ext = ucs_list_head(&worker->stream_ready_eps,
-                                         ucp_ep_ext_t, stream.ready_list);
+                                         ucp_ep_ext_stream_t,
+                                         ready_list)->ep_ext;
 
-    ucs_assert(ep_ext->stream.ready_list.next != NULL);
+    ucs_assert(ep_ext->stream->ready_list.next != NULL);
     ucp_stream_ep_dequeue(ep_ext);
     return ep_ext;
 }
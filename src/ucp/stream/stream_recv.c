@@ -63,11 +63,11 @@
 static UCS_F_ALWAYS_INLINE ucp_recv_desc_t *
 ucp_stream_rdesc_dequeue(ucp_ep_ext_t *ep_ext)
 {
-    ucp_recv_desc_t *rdesc = ucs_queue_pull_elem_non_empty(&ep_ext->stream.match_q,
+    ucp_recv_desc_t *rdesc = ucs_queue_pull_elem_non_empty(&ep_ext->stream->match_q,
                                                            ucp_recv_desc_t,
                                                            stream_queue);
     ucs_assert(ucp_stream_ep_has_data(ep_ext));
-    if (ucs_unlikely(ucs_queue_is_empty(&ep_ext->stream.match_q))) {
+    if (ucs_unlikely(ucs_queue_is_empty(&ep_ext->stream->match_q))) {
         ep_ext->ep->flags &= ~UCP_EP_FLAG_STREAM_HAS_DATA;
         if (ucp_stream_ep_is_queued(ep_ext)) {
             ucp_stream_ep_dequeue(ep_ext);
@@ -80,7 +80,7 @@ ucp_stream_rdesc_dequeue(ucp_ep_ext_t *ep_ext)
 static UCS_F_ALWAYS_INLINE ucp_recv_desc_t *
 ucp_stream_rdesc_get(ucp_ep_ext_t *ep_ext)
 {
-    ucp_recv_desc_t *rdesc = ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
+    ucp_recv_desc_t *rdesc = ucs_queue_head_elem_non_empty(&ep_ext->stream->match_q,
                                                            ucp_recv_desc_t,
                                                            stream_queue);
 
@@ -130,7 +130,7 @@ ucp_stream_rdesc_dequeue_and_release(ucp_recv_desc_t *rdesc,
                                      ucp_ep_ext_t *ep_ext)
 {
     ucs_assert(ucp_stream_ep_has_data(ep_ext));
-    ucs_assert(rdesc == ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
+    ucs_assert(rdesc == ucs_queue_head_elem_non_empty(&ep_ext->stream->match_q,
                                                       ucp_recv_desc_t,
                                                       stream_queue));
     ucp_stream_rdesc_dequeue(ep_ext);
@@ -181,7 +181,7 @@ ucp_request_complete_stream_recv(ucp_request_t *req, ucp_ep_ext_t *ep_ext,
     /* dequeue request before complete */
     ucp_request_t *UCS_V_UNUSED check_req;
 
-    check_req = ucs_queue_pull_elem_non_empty(&ep_ext->stream.match_q,
+    check_req = ucs_queue_pull_elem_non_empty(&ep_ext->stream->match_q,
                                               ucp_request_t, recv.queue);
     ucs_assert(check_req == req);
     ucs_assert((req->recv.dt_iter.offset > 0) || UCS_STATUS_IS_ERR(status));
@@ -405,7 +405,7 @@ ucp_stream_recv_request(ucp_ep_h ep, ucp_request_t *req, size_t *length,
     }
 
     ucs_assert(!ucp_stream_ep_has_data(ep_ext));
-    ucs_queue_push(&ep_ext->stream.match_q, &req->recv.queue);
+    ucs_queue_push(&ep_ext->stream->match_q, &req->recv.queue);
     return req + 1;
 }
 
@@ -477,8 +477,8 @@ ucp_stream_am_data_process(ucp_worker_t *worker, ucp_ep_ext_t *ep_ext,
 
     /* First, process expected requests */
     if (!ucp_stream_ep_has_data(ep_ext)) {
-        while (!ucs_queue_is_empty(&ep_ext->stream.match_q)) {
-            req      = ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
+        while (!ucs_queue_is_empty(&ep_ext->stream->match_q)) {
+            req      = ucs_queue_head_elem_non_empty(&ep_ext->stream->match_q,
                                                      ucp_request_t, recv.queue);
             payload  = UCS_PTR_BYTE_OFFSET(am_data, rdesc_tmp.payload_offset);
             unpacked = ucp_stream_rdata_unpack(payload, rdesc_tmp.length, req);
@@ -525,7 +525,7 @@ ucp_stream_am_data_process(ucp_worker_t *worker, ucp_ep_ext_t *ep_ext,
     }
 
     ep_ext->ep->flags |= UCP_EP_FLAG_STREAM_HAS_DATA;
-    ucs_queue_push(&ep_ext->stream.match_q, &rdesc->stream_queue);
+    ucs_queue_push(&ep_ext->stream->match_q, &rdesc->stream_queue);
 
     return UCS_INPROGRESS;
 }
@@ -535,9 +535,9 @@ void ucp_stream_ep_init(ucp_ep_h ep)
     ucp_ep_ext_t *ep_ext = ep->ext;
 
     if (ep->worker->context->config.features & UCP_FEATURE_STREAM) {
-        ep_ext->stream.ready_list.prev = NULL;
-        ep_ext->stream.ready_list.next = NULL;
-        ucs_queue_head_init(&ep_ext->stream.match_q);
+        ep_ext->stream->ready_list.prev = NULL;
+        ep_ext->stream->ready_list.next = NULL;
+        ucs_queue_head_init(&ep_ext->stream->match_q);
     }
 }
 
@@ -564,8 +564,8 @@ void ucp_stream_ep_cleanup(ucp_ep_h ep, ucs_status_t status)
 
     /* cancel not completed requests */
     ucs_assert(!ucp_stream_ep_has_data(ep_ext));
-    while (!ucs_queue_is_empty(&ep_ext->stream.match_q)) {
-        req = ucs_queue_head_elem_non_empty(&ep_ext->stream.match_q,
+    while (!ucs_queue_is_empty(&ep_ext->stream->match_q)) {
+        req = ucs_queue_head_elem_non_empty(&ep_ext->stream->match_q,
                                             ucp_request_t, recv.queue);
         ucp_request_complete_stream_recv(req, ep_ext, status);
     }
@@ -13,6 +13,7 @@
 
 #include <ucp/core/ucp_worker.h>
 #include <ucp/core/ucp_ep.inl>
+#include <ucs/algorithm/crc.h>
 #include <ucs/arch/bitops.h>
 #include <ucs/datastruct/array.h>
 #include <ucs/debug/log.h>
@@ -110,6 +111,21 @@
  *           if if_addr_len == 63
  */
 
+/* Compact address format:
+ *
+ * [ header(16bit) | uuid(64bit) | client_id | worker_name(string) ]
+ * [ dict_id(64bit) ]
+ * [ if1_addr_len(8bit) | if1_addr(var) ]
+ * [ if2_addr_len(8bit) | if2_addr(var) ]
+ *    ...
+ *
+ *   * The header has UCP_ADDRESS_HEADER_FLAG_COMPACT flag set.
+ *   * The dictionary is an address version 2 without worker uuid, client id,
+ *     worker name, and with zero-length iface addresses. Its id is the
+ *     checksum of its packed buffer.
+ *   * Iface addresses follow the order of the iface entries in the dictionary.
+ */
+
 
 typedef struct {
     size_t           dev_addr_len;
@@ -225,9 +241,14 @@ enum {
     UCP_ADDRESS_HEADER_FLAG_DEBUG_INFO  = UCS_BIT(0),  /* Address has debug info */
     UCP_ADDRESS_HEADER_FLAG_WORKER_UUID = UCS_BIT(1),  /* Worker unique id */
     UCP_ADDRESS_HEADER_FLAG_CLIENT_ID   = UCS_BIT(2),  /* Worker client id */
-    UCP_ADDRESS_HEADER_FLAG_AM_ONLY     = UCS_BIT(3)   /* Only AM lane info */
+    UCP_ADDRESS_HEADER_FLAG_AM_ONLY     = UCS_BIT(3),  /* Only AM lane info */
+    UCP_ADDRESS_HEADER_FLAG_COMPACT     = UCS_BIT(4)   /* Compact address */
 };
 
+KHASH_IMPL(ucp_worker_address_dict, uint64_t, ucp_address_dict_t*, 1,
+           kh_int64_hash_func, kh_int64_hash_equal);
+
+
 static size_t ucp_address_iface_attr_size(ucp_worker_t *worker, uint64_t flags,
                                           ucp_object_version_t addr_version)
 {
@@ -379,6 +400,7 @@ ucp_address_gather_devices(ucp_worker_h worker, const ucp_ep_config_key_t *key,
     ucp_rsc_index_t rsc_index;
     ucp_lane_index_t lane;
     ssize_t length_size;
+    size_t iface_addr_len;
 
     devices = ucs_calloc(context->num_tls, sizeof(*devices), "packed_devices");
     if (devices == NULL) {
@@ -411,29 +433,28 @@ ucp_address_gather_devices(ucp_worker_h worker, const ucp_ep_config_key_t *key,
         }
 
         dev->tl_addrs_size += sizeof(uint16_t); /* tl name checksum */
-
-        if (flags & UCP_ADDRESS_PACK_FLAG_IFACE_ADDR) {
-            /* iface address (its length will be packed in non-unified mode only) */
-            dev->tl_addrs_size += iface_attr->iface_addr_len;
-            /* iface address length (+flags) can take 2 bytes with address
-             * version 2 in non-unified mode
-             */
-            length_size         = ucp_address_packed_length_size(
-                    worker, iface_attr->iface_addr_len,
-                    UCP_ADDRESS_IFACE_LEN_MASK, addr_version,
-                    worker->context->tl_rscs[rsc_index].tl_rsc.dev_name);
-            if (length_size < 0) {
-                ucs_free(devices);
-                return length_size;
-            }
-
-            dev->tl_addrs_size += length_size;
-            dev->tl_addrs_size += ucp_address_iface_attr_size(worker, flags,
-                                                              addr_version);
-        } else {
-            dev->tl_addrs_size += 1; /* 0-value for valid unpacking */
+        dev->tl_addrs_size += ucp_address_iface_attr_size(worker, flags,
+                                                          addr_version);
+
+        /* iface address (its length will be packed in non-unified mode only),
+         * without the flag only 0-value length is packed */
+        iface_addr_len      = (flags & UCP_ADDRESS_PACK_FLAG_IFACE_ADDR) ?
+                              iface_attr->iface_addr_len : 0;
+        dev->tl_addrs_size += iface_addr_len;
+        /* iface address length (+flags) can take 2 bytes with address
+         * version 2 in non-unified mode
+         */
+        length_size         = ucp_address_packed_length_size(
+                worker, iface_addr_len, UCP_ADDRESS_IFACE_LEN_MASK,
+                addr_version,
+                worker->context->tl_rscs[rsc_index].tl_rsc.dev_name);
+        if (length_size < 0) {
+            ucs_free(devices);
+            return length_size;
         }
 
+        dev->tl_addrs_size += length_size;
+
         if (flags & UCP_ADDRESS_PACK_FLAG_DEVICE_ADDR) {
             dev->dev_addr_len = iface_attr->device_addr_len;
         } else {
@@ -463,17 +484,11 @@ ucp_address_gather_devices(ucp_worker_h worker, const ucp_ep_config_key_t *key,
     return UCS_OK;
 }
 
-static ssize_t
-ucp_address_packed_size(ucp_worker_h worker,
-                        const ucp_address_packed_device_t *devices,
-                        ucp_rsc_index_t num_devices, uint64_t pack_flags,
-                        ucp_object_version_t addr_version)
+static size_t
+ucp_address_worker_info_packed_size(ucp_worker_h worker, uint64_t pack_flags,
+                                    ucp_object_version_t addr_version)
 {
     size_t size = 0;
-    ssize_t value_size;
-    const ucp_address_packed_device_t *dev;
-    ucp_md_index_t md_index;
-    const ucp_tl_resource_desc_t *rsc;
 
     /* header: version and flags */
     if (addr_version == UCP_OBJECT_VERSION_V1) {
@@ -495,6 +510,22 @@ ucp_address_packed_size(ucp_worker_h worker,
         size += strlen(ucp_worker_get_address_name(worker)) + 1;
     }
 
+    return size;
+}
+
+static ssize_t
+ucp_address_packed_size(ucp_worker_h worker,
+                        const ucp_address_packed_device_t *devices,
+                        ucp_rsc_index_t num_devices, uint64_t pack_flags,
+                        ucp_object_version_t addr_version)
+{
+    size_t size = ucp_address_worker_info_packed_size(worker, pack_flags,
+                                                      addr_version);
+    ssize_t value_size;
+    const ucp_address_packed_device_t *dev;
+    ucp_md_index_t md_index;
+    const ucp_tl_resource_desc_t *rsc;
+
     if (num_devices == 0) {
         size += 1; /* NULL md_index */
     } else {
@@ -1190,40 +1221,15 @@ uint8_t ucp_address_is_am_only(const void *address)
     return addr_flags & UCP_ADDRESS_HEADER_FLAG_AM_ONLY;
 }
 
-static ucs_status_t
-ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
-                    unsigned pack_flags, ucp_object_version_t addr_version,
-                    const ucp_lane_index_t *lanes2remote,
-                    const ucp_address_packed_device_t *devices,
-                    ucp_rsc_index_t num_devices)
+static void *ucp_address_pack_worker_info(ucp_worker_h worker, void *buffer,
+                                          unsigned pack_flags,
+                                          ucp_object_version_t addr_version,
+                                          uint8_t addr_flags)
 {
-    ucp_context_h context = worker->context;
-    const ucp_address_packed_device_t *dev;
-    uint8_t *address_header_p;
-    uct_iface_attr_t *iface_attr;
-    ucp_md_index_t md_index;
-    ucp_worker_iface_t *wiface;
-    ucp_rsc_index_t rsc_index;
-    ucp_lane_index_t lane, remote_lane;
-    ucp_tl_bitmap_t dev_tl_bitmap;
-    unsigned num_ep_addrs;
-    ucs_status_t status;
-    size_t iface_addr_len;
-    size_t ep_addr_len;
-    uint8_t *ep_lane_ptr;
-    void *flags_ptr, *dev_flags_ptr;
-    unsigned addr_index;
-    int attr_len;
+    uint8_t *address_header_p = buffer;
     void *ptr;
-    int enable_amo;
-    uint8_t addr_flags;
 
-    ptr               = buffer;
-    addr_index        = 0;
-    addr_flags        = 0;
-    address_header_p  = ptr;
-    ptr               = ucp_address_pack_header(address_header_p, addr_version);
-    dev_flags_ptr     = NULL;
+    ptr = ucp_address_pack_header(address_header_p, addr_version);
 
     if (pack_flags & UCP_ADDRESS_PACK_FLAG_AM_ONLY) {
         addr_flags |= UCP_ADDRESS_HEADER_FLAG_AM_ONLY;
@@ -1253,6 +1259,39 @@ ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
     }
 
     ucp_address_pack_header_flags(address_header_p, addr_version, addr_flags);
+    return ptr;
+}
+
+static ucs_status_t
+ucp_address_do_pack(ucp_worker_h worker, ucp_ep_h ep, void *buffer, size_t size,
+                    unsigned pack_flags, ucp_object_version_t addr_version,
+                    const ucp_lane_index_t *lanes2remote,
+                    const ucp_address_packed_device_t *devices,
+                    ucp_rsc_index_t num_devices)
+{
+    ucp_context_h context = worker->context;
+    const ucp_address_packed_device_t *dev;
+    uct_iface_attr_t *iface_attr;
+    ucp_md_index_t md_index;
+    ucp_worker_iface_t *wiface;
+    ucp_rsc_index_t rsc_index;
+    ucp_lane_index_t lane, remote_lane;
+    ucp_tl_bitmap_t dev_tl_bitmap;
+    unsigned num_ep_addrs;
+    ucs_status_t status;
+    size_t iface_addr_len;
+    size_t ep_addr_len;
+    uint8_t *ep_lane_ptr;
+    void *flags_ptr, *dev_flags_ptr;
+    unsigned addr_index;
+    int attr_len;
+    void *ptr;
+    int enable_amo;
+
+    addr_index    = 0;
+    dev_flags_ptr = NULL;
+    ptr           = ucp_address_pack_worker_info(worker, buffer, pack_flags,
+                                                 addr_version, 0);
 
     if (num_devices == 0) {
         *((uint8_t*)ptr) = UCP_NULL_RESOURCE;
@@ -1601,6 +1640,157 @@ out:
     return status;
 }
 
+static unsigned ucp_address_dict_pack_flags(unsigned pack_flags)
+{
+    /* Dictionary contains only the parts which are shared by all workers with
+     * the same configuration on the same host */
+    return pack_flags & ~(UCP_ADDRESS_PACK_FLAG_WORKER_UUID |
+                          UCP_ADDRESS_PACK_FLAG_WORKER_NAME |
+                          UCP_ADDRESS_PACK_FLAG_CLIENT_ID |
+                          UCP_ADDRESS_PACK_FLAG_IFACE_ADDR |
+                          UCP_ADDRESS_PACK_FLAG_EP_ADDR);
+}
+
+static uint64_t ucp_address_dict_id(const void *buffer, size_t length)
+{
+    return ((uint64_t)ucs_crc32c(0, buffer, length) << 32) |
+           ucs_crc32(0, buffer, length);
+}
+
+static ucs_status_t ucp_address_compact_check(ucp_worker_h worker)
+{
+    if (ucp_worker_is_unified_mode(worker)) {
+        /* Unified mode takes iface address length from the local iface, so
+         * it cannot be omitted in the dictionary */
+        ucs_error("worker %p: compact address is not supported in unified "
+                  "mode", worker);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    return UCS_OK;
+}
+
+ucs_status_t ucp_address_pack_dict(ucp_worker_h worker,
+                                   const ucp_tl_bitmap_t *tl_bitmap,
+                                   unsigned pack_flags, size_t *size_p,
+                                   void **buffer_p)
+{
+    ucs_status_t status;
+
+    status = ucp_address_compact_check(worker);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    return ucp_address_pack(worker, NULL, tl_bitmap,
+                            ucp_address_dict_pack_flags(pack_flags),
+                            UCP_OBJECT_VERSION_V2, NULL, UINT_MAX, size_p,
+                            buffer_p);
+}
+
+ucs_status_t ucp_address_pack_compact(ucp_worker_h worker,
+                                      const ucp_tl_bitmap_t *tl_bitmap,
+                                      unsigned pack_flags, size_t *size_p,
+                                      void **buffer_p)
+{
+    const ucp_object_version_t addr_version = UCP_OBJECT_VERSION_V2;
+    ucp_context_h context                   = worker->context;
+    const ucp_address_packed_device_t *dev;
+    ucp_address_packed_device_t *devices;
+    ucp_rsc_index_t num_devices, rsc_index;
+    ucp_tl_bitmap_t dev_tl_bitmap;
+    ucp_worker_iface_t *wiface;
+    size_t dict_length, size;
+    void *dict, *buffer, *ptr;
+    uint64_t dict_id;
+    ucs_status_t status;
+
+    status = ucp_address_pack_dict(worker, tl_bitmap, pack_flags, &dict_length,
+                                   &dict);
+    if (status != UCS_OK) {
+        goto out;
+    }
+
+    dict_id = ucp_address_dict_id(dict, dict_length);
+    ucs_free(dict);
+
+    /* Collect the same devices as the dictionary, in the same order */
+    pack_flags &= ~UCP_ADDRESS_PACK_FLAG_EP_ADDR;
+    status      = ucp_address_gather_devices(worker, NULL, tl_bitmap,
+                                             pack_flags, addr_version,
+                                             UINT_MAX, &devices, &num_devices);
+    if (status != UCS_OK) {
+        goto out;
+    }
+
+    size  = ucp_address_worker_info_packed_size(worker, pack_flags,
+                                                addr_version);
+    size += sizeof(dict_id);
+    for (dev = devices; dev < (devices + num_devices); ++dev) {
+        dev_tl_bitmap = context->tl_bitmap;
+        UCS_STATIC_BITMAP_AND_INPLACE(&dev_tl_bitmap, dev->tl_bitmap);
+        UCS_STATIC_BITMAP_FOR_EACH_BIT(rsc_index, &dev_tl_bitmap) {
+            size += sizeof(uint8_t) +
+                    ucp_worker_iface(worker, rsc_index)->attr.iface_addr_len;
+        }
+    }
+
+    buffer = ucs_calloc(1, size, "ucp_address");
+    if (buffer == NULL) {
+        status = UCS_ERR_NO_MEMORY;
+        goto out_free_devices;
+    }
+
+    ptr = ucp_address_pack_worker_info(worker, buffer, pack_flags,
+                                       addr_version,
+                                       UCP_ADDRESS_HEADER_FLAG_COMPACT);
+    *ucs_serialize_next(&ptr, uint64_t) = dict_id;
+
+    for (dev = devices; dev < (devices + num_devices); ++dev) {
+        dev_tl_bitmap = context->tl_bitmap;
+        UCS_STATIC_BITMAP_AND_INPLACE(&dev_tl_bitmap, dev->tl_bitmap);
+        UCS_STATIC_BITMAP_FOR_EACH_BIT(rsc_index, &dev_tl_bitmap) {
+            wiface = ucp_worker_iface(worker, rsc_index);
+            ucs_assertv_always(wiface->attr.iface_addr_len <= UINT8_MAX,
+                               "iface_addr_len=%zu",
+                               wiface->attr.iface_addr_len);
+            *ucs_serialize_next(&ptr, uint8_t) = wiface->attr.iface_addr_len;
+
+            status = uct_iface_get_address(wiface->iface,
+                                           (uct_iface_addr_t*)ptr);
+            if (status != UCS_OK) {
+                ucp_address_error(
+                        pack_flags,
+                        UCT_TL_RESOURCE_DESC_FMT
+                        " failed to get iface address %s",
+                        UCT_TL_RESOURCE_DESC_ARG(
+                                &context->tl_rscs[rsc_index].tl_rsc),
+                        ucs_status_string(status));
+                ucs_free(buffer);
+                goto out_free_devices;
+            }
+
+            ucp_address_memcheck(context, ptr, wiface->attr.iface_addr_len,
+                                 rsc_index);
+            ptr = UCS_PTR_BYTE_OFFSET(ptr, wiface->attr.iface_addr_len);
+        }
+    }
+
+    ucs_assertv(UCS_PTR_BYTE_OFFSET(buffer, size) == ptr,
+                "buffer=%p size=%zu ptr=%p", buffer, size, ptr);
+    ucp_address_trace(pack_flags,
+                      "packed compact address of size %zu, dictionary 0x%" PRIx64
+                      " of size %zu", size, dict_id, dict_length);
+
+    *size_p   = size;
+    *buffer_p = buffer;
+
+out_free_devices:
+    ucs_free(devices);
+out:
+    return status;
+}
+
 static ucp_rsc_index_t ucp_address_get_remote_device_index(
         ucp_address_remote_device_array_t *device_array,
         ucp_rsc_index_t dev_index, ucs_sys_device_t sys_dev)
@@ -1646,6 +1836,61 @@ ucp_address_adjust_unpacked_md_index(ucp_unpacked_address_t *unpacked_address)
     }
 }
 
+static ucs_status_t
+ucp_address_unpack_compact(ucp_worker_h worker, const void *buffer,
+                           const void *ptr, unsigned unpack_flags,
+                           ucp_unpacked_address_t *unpacked_address)
+{
+    uint64_t dict_id = *ucs_serialize_next(&ptr, const uint64_t);
+    const ucp_unpacked_address_t *shared;
+    ucp_address_entry_t *address;
+    uint8_t iface_addr_len;
+    khiter_t iter;
+
+    iter = kh_get(ucp_worker_address_dict, &worker->address_dict_hash,
+                  dict_id);
+    if (iter == kh_end(&worker->address_dict_hash)) {
+        ucp_address_error(unpack_flags,
+                          "address dictionary 0x%" PRIx64 " was not imported",
+                          dict_id);
+        return UCS_ERR_NO_ELEM;
+    }
+
+    shared                         = &kh_val(&worker->address_dict_hash,
+                                             iter)->address;
+    unpacked_address->addr_version = shared->addr_version;
+    unpacked_address->dst_version  = shared->dst_version;
+    if (shared->address_count == 0) {
+        unpacked_address->length = UCS_PTR_BYTE_DIFF(buffer, ptr);
+        return UCS_OK;
+    }
+
+    /* Shared parts were parsed when the dictionary was imported */
+    unpacked_address->address_list = ucs_calloc(UCP_MAX_RESOURCES,
+                                                sizeof(*address),
+                                                "ucp_address_list");
+    if (unpacked_address->address_list == NULL) {
+        ucs_error("failed to allocate address list");
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    memcpy(unpacked_address->address_list, shared->address_list,
+           shared->address_count * sizeof(*address));
+    unpacked_address->address_count = shared->address_count;
+
+    ucp_unpacked_address_for_each(address, unpacked_address) {
+        iface_addr_len      = *ucs_serialize_next(&ptr, const uint8_t);
+        address->iface_addr = (iface_addr_len > 0) ? ptr : NULL;
+        ptr                 = UCS_PTR_BYTE_OFFSET(ptr, iface_addr_len);
+    }
+
+    unpacked_address->length = UCS_PTR_BYTE_DIFF(buffer, ptr);
+    ucp_address_trace(unpack_flags,
+                      "unpacked compact address with %u entries, dictionary "
+                      "0x%" PRIx64, unpacked_address->address_count, dict_id);
+    return UCS_OK;
+}
+
 ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
                                 unsigned unpack_flags,
                                 ucp_unpacked_address_t *unpacked_address)
@@ -1714,8 +1959,15 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
                          sizeof(unpacked_address->name));
     }
 
+    if (addr_flags & UCP_ADDRESS_HEADER_FLAG_COMPACT) {
+        return ucp_address_unpack_compact(worker, buffer, ptr, unpack_flags,
+                                          unpacked_address);
+    }
+
     /* Empty address list */
     if (*(uint8_t*)ptr == UCP_NULL_RESOURCE) {
+        unpacked_address->length = UCS_PTR_BYTE_DIFF(
+                buffer, UCS_PTR_TYPE_OFFSET(ptr, UCP_NULL_RESOURCE));
         return UCS_OK;
     }
 
@@ -1870,6 +2122,7 @@ ucs_status_t ucp_address_unpack(ucp_worker_t *worker, const void *buffer,
     unpacked_address->dst_version   = dst_version;
     unpacked_address->address_count = address - address_list;
     unpacked_address->address_list  = address_list;
+    unpacked_address->length        = UCS_PTR_BYTE_DIFF(buffer, ptr);
 
     ucp_address_adjust_unpacked_md_index(unpacked_address);
     return UCS_OK;
@@ -1878,3 +2131,90 @@ err_free:
     ucs_free(address_list);
     return UCS_ERR_INVALID_PARAM;
 }
+
+ucs_status_t ucp_address_dict_import(ucp_worker_h worker, const void *buffer,
+                                     size_t length)
+{
+    uint64_t dict_id = ucp_address_dict_id(buffer, length);
+    ucp_address_dict_t *dict;
+    ucs_status_t status;
+    khiter_t iter;
+    int ret;
+
+    iter = kh_get(ucp_worker_address_dict, &worker->address_dict_hash,
+                  dict_id);
+    if (iter != kh_end(&worker->address_dict_hash)) {
+        /* Imported already, for example from another peer on the same host */
+        return UCS_OK;
+    }
+
+    status = ucp_address_compact_check(worker);
+    if (status != UCS_OK) {
+        goto err;
+    }
+
+    dict = ucs_malloc(sizeof(*dict), "ucp_address_dict");
+    if (dict == NULL) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err;
+    }
+
+    dict->buffer = ucs_malloc(length, "ucp_address_dict_buffer");
+    if (dict->buffer == NULL) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_free_dict;
+    }
+
+    memcpy(dict->buffer, buffer, length);
+    dict->id = dict_id;
+
+    status = ucp_address_unpack(worker, dict->buffer,
+                                ucp_address_dict_pack_flags(
+                                    ucp_worker_default_address_pack_flags(
+                                        worker)),
+                                &dict->address);
+    if (status != UCS_OK) {
+        goto err_free_buffer;
+    }
+
+    iter = kh_put(ucp_worker_address_dict, &worker->address_dict_hash, dict_id,
+                  &ret);
+    if (ret == UCS_KH_PUT_FAILED) {
+        status = UCS_ERR_NO_MEMORY;
+        goto err_free_address_list;
+    }
+
+    kh_val(&worker->address_dict_hash, iter) = dict;
+
+    ucs_debug("worker %p: imported address dictionary 0x%" PRIx64
+              " of size %zu with %u entries", worker, dict_id, length,
+              dict->address.address_count);
+    return UCS_OK;
+
+err_free_address_list:
+    ucs_free(dict->address.address_list);
+err_free_buffer:
+    ucs_free(dict->buffer);
+err_free_dict:
+    ucs_free(dict);
+err:
+    return status;
+}
+
+void ucp_address_dict_init(ucp_worker_h worker)
+{
+    kh_init_inplace(ucp_worker_address_dict, &worker->address_dict_hash);
+}
+
+void ucp_address_dict_cleanup(ucp_worker_h worker)
+{
+    ucp_address_dict_t *dict;
+
+    kh_foreach_value(&worker->address_dict_hash, dict, {
+        ucs_free(dict->address.address_list);
+        ucs_free(dict->buffer);
+        ucs_free(dict);
+    })
+
+    kh_destroy_inplace(ucp_worker_address_dict, &worker->address_dict_hash);
+}
@@ -167,6 +167,19 @@ struct ucp_unpacked_address {
     ucp_address_entry_t         *address_list;  /* Pointer to address list */
     ucp_object_version_t        addr_version;   /* Peer address version */
     unsigned                    dst_version;    /* Peer release version */
+    size_t                      length;         /* Packed address length */
+};
+
+
+/**
+ * Address dictionary: the parts of a worker address which are shared by all
+ * workers with the same configuration on the same host.
+ */
+struct ucp_address_dict {
+    uint64_t                    id;             /* Dictionary id */
+    void                        *buffer;        /* Packed dictionary */
+    ucp_unpacked_address_t      address;        /* Unpacked dictionary, entries
+                                                   point into 'buffer' */
 };
 
 
@@ -251,12 +264,73 @@ ucs_status_t ucp_address_pack(ucp_worker_h worker, ucp_ep_h ep,
  *
  * @note The address list inside @ref ucp_remote_address_t should be released
  *       by ucs_free().
+ *
+ * @note A compact address is unpacked by copying the entries of its imported
+ *       dictionary, so the shared parts are parsed only once per dictionary.
  */
 ucs_status_t ucp_address_unpack(ucp_worker_h worker, const void *buffer,
                                 unsigned unpack_flags,
                                 ucp_unpacked_address_t *unpacked_address);
 
 
+/**
+ * Pack the address dictionary of a worker. The dictionary contains device
+ * addresses and transport attributes, but not the worker unique id and
+ * interface addresses.
+ *
+ * @param [in]  worker        Worker object whose dictionary to pack.
+ * @param [in]  tl_bitmap     Specifies the resources to pack.
+ * @param [in]  pack_flags    UCP_ADDRESS_PACK_FLAG_xx flags of the compact
+ *                            address which will refer to this dictionary.
+ * @param [out] size_p        Filled with buffer size.
+ * @param [out] buffer_p      Filled with pointer to packed buffer. It should be
+ *                            released by ucs_free().
+ */
+ucs_status_t ucp_address_pack_dict(ucp_worker_h worker,
+                                   const ucp_tl_bitmap_t *tl_bitmap,
+                                   unsigned pack_flags, size_t *size_p,
+                                   void **buffer_p);
+
+
+/**
+ * Pack a compact worker address, which contains only the worker unique id and
+ * interface addresses, and refers to the dictionary packed by
+ * @ref ucp_address_pack_dict with the same arguments.
+ *
+ * @param [in]  worker        Worker object whose address to pack.
+ * @param [in]  tl_bitmap     Specifies the resources to pack.
+ * @param [in]  pack_flags    UCP_ADDRESS_PACK_FLAG_xx flags to specify address
+ *                            format.
+ * @param [out] size_p        Filled with buffer size.
+ * @param [out] buffer_p      Filled with pointer to packed buffer. It should be
+ *                            released by ucs_free().
+ */
+ucs_status_t ucp_address_pack_compact(ucp_worker_h worker,
+                                      const ucp_tl_bitmap_t *tl_bitmap,
+                                      unsigned pack_flags, size_t *size_p,
+                                      void **buffer_p);
+
+
+/**
+ * Import an address dictionary to the worker, so compact addresses which refer
+ * to it could be unpacked by @ref ucp_address_unpack.
+ *
+ * @param [in]  worker        Worker object to import the dictionary to.
+ * @param [in]  buffer        Dictionary packed by @ref ucp_address_pack_dict.
+ * @param [in]  length        Dictionary length.
+ */
+ucs_status_t ucp_address_dict_import(ucp_worker_h worker, const void *buffer,
+                                     size_t length);
+
+
+/**
+ * Initialize and cleanup the imported address dictionaries of a worker.
+ */
+void ucp_address_dict_init(ucp_worker_h worker);
+
+void ucp_address_dict_cleanup(ucp_worker_h worker);
+
+
 /**
  * Unpack worker unique id from the given address.
  *
@@ -538,6 +538,91 @@ out_unblock:
     return 0;
 }
 
+static void ucp_wireup_lazy_set_failed(ucp_ep_h ep, unsigned ep_init_flags,
+                                       ucs_queue_head_t *pending_queue,
+                                       ucs_status_t status)
+{
+    ucp_wireup_ep_t *wireup_ep;
+    ucs_status_t stub_status;
+
+    ucs_diag("ep %p: failed to initialize lanes of lazy endpoint: %s", ep,
+             ucs_status_string(status));
+
+    /* Return the endpoint to a stub, so the queued operations could be
+     * completed by the error flow */
+    if (ep->cfg_index != UCP_WORKER_CFG_INDEX_NULL) {
+        ucp_ep_cleanup_lanes(ep);
+        ep->cfg_index = UCP_WORKER_CFG_INDEX_NULL;
+    }
+
+    stub_status = ucp_ep_init_create_wireup(ep, ep_init_flags, &wireup_ep);
+    if (stub_status != UCS_OK) {
+        ucs_fatal("ep %p: failed to restore lazy endpoint stub: %s", ep,
+                  ucs_status_string(stub_status));
+    }
+
+    ucp_wireup_replay_pending_requests(ep, pending_queue);
+    ucp_ep_set_failed_schedule(ep, UCP_NULL_LANE, status);
+}
+
+static void ucp_wireup_lazy_init_lanes(ucp_ep_h ep)
+{
+    ucp_worker_h worker = ep->worker;
+    ucp_unpacked_address_t remote_address;
+    unsigned addr_indices[UCP_MAX_LANES];
+    ucs_queue_head_t pending_queue;
+    unsigned ep_init_flags;
+    int am_need_flush;
+    ucs_status_t status;
+    void *address;
+
+    address = ucp_ep_lazy_release_stub(ep, &ep_init_flags, &pending_queue);
+    ucs_debug("ep %p: connecting lazy endpoint", ep);
+
+    status = ucp_address_unpack(worker, address,
+                                ucp_worker_default_address_pack_flags(worker),
+                                &remote_address);
+    if (status != UCS_OK) {
+        goto err_set_failed;
+    }
+
+    status = ucp_wireup_init_lanes(ep, ep_init_flags, &ucp_tl_bitmap_max,
+                                   &remote_address, addr_indices,
+                                   &am_need_flush);
+    ucs_free(remote_address.address_list);
+    if (status != UCS_OK) {
+        goto err_set_failed;
+    }
+
+    if (!(ep->flags & UCP_EP_FLAG_LOCAL_CONNECTED)) {
+        ucp_wireup_send_request(ep);
+    }
+
+    ucs_free(address);
+    ucp_wireup_replay_pending_requests(ep, &pending_queue);
+    return;
+
+err_set_failed:
+    ucs_free(address);
+    ucp_wireup_lazy_set_failed(ep, ep_init_flags, &pending_queue, status);
+}
+
+void ucp_wireup_lazy_connect(ucp_ep_h ep)
+{
+    UCS_ASYNC_BLOCK(&ep->worker->async);
+    if ((ep->flags & (UCP_EP_FLAG_LAZY_WIREUP | UCP_EP_FLAG_FAILED)) ==
+        UCP_EP_FLAG_LAZY_WIREUP) {
+        ucp_wireup_lazy_init_lanes(ep);
+    }
+    UCS_ASYNC_UNBLOCK(&ep->worker->async);
+}
+
+unsigned ucp_wireup_lazy_progress(void *arg)
+{
+    ucp_wireup_lazy_connect((ucp_ep_h)arg);
+    return 1;
+}
+
 void ucp_wireup_update_flags(ucp_ep_h ucp_ep, uint32_t new_flags)
 {
     ucp_lane_index_t lane;
@@ -643,6 +728,9 @@ ucp_wireup_process_request(ucp_worker_h worker, ucp_ep_h ep,
     ucp_tl_bitmap_t tl_bitmap = UCS_STATIC_BITMAP_ZERO_INITIALIZER;
     ucp_lane_index_t lanes2remote[UCP_MAX_LANES];
     unsigned addr_indices[UCP_MAX_LANES];
+    int is_lazy               = 0;
+    unsigned lazy_ep_init_flags;
+    ucs_queue_head_t lazy_pending_queue;
     ucs_status_t status;
     int has_cm_lane, am_need_flush, full_handshake_required;
 
@@ -713,14 +801,30 @@ ucp_wireup_process_request(ucp_worker_h worker, ucp_ep_h ep,
         ep_init_flags |= UCP_EP_INIT_CM_WIREUP_SERVER;
     }
 
+    ucs_queue_head_init(&lazy_pending_queue);
+    if (ep->flags & UCP_EP_FLAG_LAZY_WIREUP) {
+        /* The peer connected first, the lanes are selected according to the
+         * request address instead of the stored one */
+        ucs_free(ucp_ep_lazy_release_stub(ep, &lazy_ep_init_flags,
+                                          &lazy_pending_queue));
+        is_lazy = 1;
+    }
+
     /* Initialize lanes (possible destroy existing lanes) */
     status = ucp_wireup_init_lanes(ep, ep_init_flags, &ucp_tl_bitmap_max,
                                    remote_address, addr_indices,
                                    &am_need_flush);
     if (status != UCS_OK) {
+        if (is_lazy) {
+            ucp_wireup_lazy_set_failed(ep, lazy_ep_init_flags,
+                                       &lazy_pending_queue, status);
+            return;
+        }
         goto err_set_ep_failed;
     }
 
+    ucp_wireup_replay_pending_requests(ep, &lazy_pending_queue);
+
     ucp_wireup_match_p2p_lanes(ep, remote_address, addr_indices, lanes2remote);
 
     /* Full handshake is required in the following cases:
@@ -2026,16 +2130,24 @@ ucs_status_t ucp_wireup_send_pre_request(ucp_ep_h ep)
 
 ucs_status_t ucp_wireup_connect_remote(ucp_ep_h ep, ucp_lane_index_t lane)
 {
-    uct_ep_h uct_ep = ucp_ep_get_lane(ep, lane);
     ucs_queue_head_t tmp_q;
     ucs_status_t status;
     ucp_request_t *req;
     uct_ep_h wireup_ep;
+    uct_ep_h uct_ep;
 
     ucs_trace("ep %p: connect lane %d to remote peer", ep, lane);
 
     UCS_ASYNC_BLOCK(&ep->worker->async);
 
+    if (ep->flags & UCP_EP_FLAG_LAZY_WIREUP) {
+        /* The remote ID is resolved on the lanes selected for the peer */
+        ucp_wireup_lazy_init_lanes(ep);
+        lane = ep->am_lane;
+    }
+
+    uct_ep = ucp_ep_get_lane(ep, lane);
+
     /* Checking again, with lock held, if already connected, connection is in
      * progress, or the endpoint is in failed state.
      */
@@ -146,6 +146,28 @@ ucp_wireup_ep_pending_req_release(uct_pending_req_t *self, void *arg)
     ucs_free(proxy_req);
 }
 
+static int
+ucp_wireup_ep_lazy_progress_remove_filter(const ucs_callbackq_elem_t *elem,
+                                          void *arg)
+{
+    return (elem->cb == ucp_wireup_lazy_progress) && (elem->arg == arg);
+}
+
+static void ucp_wireup_ep_lazy_sched(ucp_wireup_ep_t *wireup_ep)
+{
+    ucp_ep_h ucp_ep = wireup_ep->super.ucp_ep;
+
+    if (wireup_ep->flags & UCP_WIREUP_EP_FLAG_LAZY_SCHED) {
+        return;
+    }
+
+    ucs_debug("ep %p: schedule lazy wireup", ucp_ep);
+    wireup_ep->flags |= UCP_WIREUP_EP_FLAG_LAZY_SCHED;
+    ucs_callbackq_add_oneshot(&ucp_ep->worker->uct->progress_q, ucp_ep,
+                              ucp_wireup_lazy_progress, ucp_ep);
+    ucp_worker_signal_internal(ucp_ep->worker);
+}
+
 static ucs_status_t ucp_wireup_ep_pending_add(uct_ep_h uct_ep,
                                               uct_pending_req_t *req,
                                               unsigned flags)
@@ -182,6 +204,9 @@ static ucs_status_t ucp_wireup_ep_pending_add(uct_ep_h uct_ep,
     } else {
         ucs_queue_push(&wireup_ep->pending_q, ucp_wireup_ep_req_priv(req));
         ucp_worker_flush_ops_count_add(worker, +1);
+        if (ucp_ep->flags & UCP_EP_FLAG_LAZY_WIREUP) {
+            ucp_wireup_ep_lazy_sched(wireup_ep);
+        }
         status = UCS_OK;
     }
 out:
@@ -344,6 +369,13 @@ static ucs_status_t ucp_wireup_ep_flush(uct_ep_h uct_ep, unsigned flags,
         }
         return UCS_OK;
     }
+
+    /* Nothing was sent on a lazy endpoint until an operation is queued */
+    if ((wireup_ep->super.ucp_ep->flags & UCP_EP_FLAG_LAZY_WIREUP) &&
+        ucs_queue_is_empty(&wireup_ep->pending_q)) {
+        return UCS_OK;
+    }
+
     return UCS_ERR_NO_RESOURCE;
 }
 
@@ -434,6 +466,7 @@ UCS_CLASS_INIT_FUNC(ucp_wireup_ep_t, ucp_ep_h ucp_ep)
     self->aux_rsc_index = UCP_NULL_RESOURCE;
     self->pending_count = 0;
     self->flags         = 0;
+    self->lazy_address  = NULL;
     ucs_queue_head_init(&self->pending_q);
     UCS_STATIC_BITMAP_RESET_ALL(&self->cm_resolve_tl_bitmap);
 
@@ -456,6 +489,14 @@ static UCS_CLASS_CLEANUP_FUNC(ucp_wireup_ep_t)
 
     ucs_debug("ep %p: destroy wireup ep %p", ucp_ep, self);
 
+    if (self->flags & UCP_WIREUP_EP_FLAG_LAZY_SCHED) {
+        ucs_callbackq_remove_oneshot(&worker->uct->progress_q, ucp_ep,
+                                     ucp_wireup_ep_lazy_progress_remove_filter,
+                                     ucp_ep);
+    }
+
+    ucs_free(self->lazy_address);
+
     if (self->aux_ep != NULL) {
         /* No pending operations should be scheduled */
         ucp_wireup_ep_discard_aux_ep(self, UCT_FLUSH_FLAG_CANCEL,
@@ -473,9 +514,11 @@ static UCS_CLASS_CLEANUP_FUNC(ucp_wireup_ep_t)
         ucp_proxy_ep_set_uct_ep(&self->super, NULL, 0, UCP_NULL_RESOURCE);
     }
 
-    UCS_ASYNC_BLOCK(&worker->async);
-    ucp_worker_flush_ops_count_add(worker, -1);
-    UCS_ASYNC_UNBLOCK(&worker->async);
+    if (!(self->flags & UCP_WIREUP_EP_FLAG_LAZY)) {
+        UCS_ASYNC_BLOCK(&worker->async);
+        ucp_worker_flush_ops_count_add(worker, -1);
+        UCS_ASYNC_UNBLOCK(&worker->async);
+    }
 }
 
 UCS_CLASS_DEFINE(ucp_wireup_ep_t, ucp_proxy_ep_t);
@@ -548,6 +591,41 @@ err:
     return status;
 }
 
+ucs_status_t ucp_wireup_ep_set_lazy(uct_ep_h uct_ep, const void *address,
+                                    size_t length, unsigned ep_init_flags)
+{
+    ucp_wireup_ep_t *wireup_ep = ucp_wireup_ep(uct_ep);
+    ucp_worker_h worker        = wireup_ep->super.ucp_ep->worker;
+
+    ucs_assert(!(wireup_ep->flags & UCP_WIREUP_EP_FLAG_LAZY));
+
+    wireup_ep->lazy_address = ucs_malloc(length, "ucp_lazy_address");
+    if (wireup_ep->lazy_address == NULL) {
+        ucs_error("failed to allocate remote address of length %zu", length);
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    memcpy(wireup_ep->lazy_address, address, length);
+    wireup_ep->ep_init_flags = ep_init_flags;
+    wireup_ep->flags        |= UCP_WIREUP_EP_FLAG_LAZY;
+
+    /* Nothing is in flight until the first operation is queued */
+    UCS_ASYNC_BLOCK(&worker->async);
+    ucp_worker_flush_ops_count_add(worker, -1);
+    UCS_ASYNC_UNBLOCK(&worker->async);
+    return UCS_OK;
+}
+
+void *ucp_wireup_ep_extract_lazy_address(uct_ep_h uct_ep)
+{
+    ucp_wireup_ep_t *wireup_ep = ucp_wireup_ep(uct_ep);
+    void *address              = wireup_ep->lazy_address;
+
+    ucs_assert(wireup_ep->flags & UCP_WIREUP_EP_FLAG_LAZY);
+    wireup_ep->lazy_address = NULL;
+    return address;
+}
+
 int ucp_wireup_ep_has_next_ep(ucp_wireup_ep_t *wireup_ep)
 {
     ucs_assert(wireup_ep != NULL);
@@ -32,7 +32,13 @@ enum {
     UCP_WIREUP_EP_FLAG_SEND_CLIENT_ID   = UCS_BIT(3),
 
     /* Indicates that aux_ep is CONNECT_TO_EP */
-    UCP_WIREUP_EP_FLAG_AUX_P2P          = UCS_BIT(4)
+    UCP_WIREUP_EP_FLAG_AUX_P2P          = UCS_BIT(4),
+
+    /* Stub of a lazy endpoint, holds the remote worker address */
+    UCP_WIREUP_EP_FLAG_LAZY             = UCS_BIT(5),
+
+    /* Wireup of a lazy endpoint is scheduled on the progress queue */
+    UCP_WIREUP_EP_FLAG_LAZY_SCHED       = UCS_BIT(6)
 };
 
 
@@ -57,6 +63,8 @@ struct ucp_wireup_ep {
     unsigned                  ep_init_flags; /**< UCP wireup EP init flags */
     /**< TLs which are available on client side resolved device */
     ucp_tl_bitmap_t           cm_resolve_tl_bitmap;
+    /**< Copy of the remote worker address of a lazy endpoint */
+    void                      *lazy_address;
 };
 
 
@@ -104,6 +112,20 @@ void ucp_wireup_ep_discard_aux_ep(ucp_wireup_ep_t *wireup_ep,
                                   uct_pending_purge_callback_t purge_cb,
                                   void *purge_arg);
 
+/**
+ * Make the stub endpoint hold the remote worker address of a lazy endpoint.
+ * The stub does not delay worker flush until an operation is queued on it.
+ *
+ * @param [in]  uct_ep         Stub endpoint.
+ * @param [in]  address        Packed remote worker address.
+ * @param [in]  length         Length of the packed remote worker address.
+ * @param [in]  ep_init_flags  Initial flags of UCP EP.
+ */
+ucs_status_t ucp_wireup_ep_set_lazy(uct_ep_h uct_ep, const void *address,
+                                    size_t length, unsigned ep_init_flags);
+
+void *ucp_wireup_ep_extract_lazy_address(uct_ep_h uct_ep);
+
 int ucp_wireup_ep_has_next_ep(ucp_wireup_ep_t *wireup_ep);
 
 void ucp_wireup_ep_set_next_ep(uct_ep_h uct_ep, uct_ep_h next_ep,
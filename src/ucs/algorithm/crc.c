@@ -9,9 +9,18 @@
 #endif
 
 #include <ucs/algorithm/crc.h>
+#include <ucs/arch/cpu.h>
 
 #include <string.h>
 
+#if defined(__x86_64__)
+#  include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#  include <arm_acle.h>
+#  include <sys/auxv.h>
+#  include <asm/hwcap.h>
+#endif
+
 
 /* CRC-16-CCITT */
 #define UCS_CRC16_POLY    0x8408u
@@ -19,6 +28,32 @@
 /* CRC-32 (ISO 3309) */
 #define UCS_CRC32_POLY    0xedb88320l
 
+/* CRC-32C (Castagnoli), reflected */
+#define UCS_CRC32C_POLY   0x82f63b78u
+
+/*
+ * Block sizes for the 3-way interleaved hardware CRC32C calculation. The
+ * crc32 instruction has a latency of 3 cycles and a throughput of 1 cycle, so
+ * three independent streams keep the pipeline full; partial results are
+ * combined by shifting them over the length of the following blocks.
+ */
+#define UCS_CRC32C_LONG   8192
+#define UCS_CRC32C_SHORT  256
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#  define UCS_CRC32C_HW   1
+#  define UCS_CRC32C_HW_ATTR __attribute__((target("sse4.2")))
+#  define UCS_CRC32C_HW_U8(_crc, _value)  _mm_crc32_u8(_crc, _value)
+#  define UCS_CRC32C_HW_U64(_crc, _value) _mm_crc32_u64(_crc, _value)
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#  define UCS_CRC32C_HW   1
+#  define UCS_CRC32C_HW_ATTR
+#  define UCS_CRC32C_HW_U8(_crc, _value)  __crc32cb(_crc, _value)
+#  define UCS_CRC32C_HW_U64(_crc, _value) __crc32cd(_crc, _value)
+#else
+#  define UCS_CRC32C_HW   0
+#endif
+
 #define UCS_CRC_CALC(_width, _buffer, _size, _crc) \
     do { \
         const uint8_t *end = (const uint8_t*)(UCS_PTR_BYTE_OFFSET(_buffer, _size)); \
@@ -56,3 +91,228 @@ uint32_t ucs_crc32(uint32_t prev_crc, const void *buffer, size_t size)
     UCS_CRC_CALC(32, buffer, size, crc);
     return crc;
 }
+
+
+/* Slicing-by-8 lookup tables for the software CRC32C */
+static uint32_t ucs_crc32c_table[8][256];
+
+#if UCS_CRC32C_HW
+/* Operators which shift a CRC32C value over LONG and SHORT blocks of zeros */
+static uint32_t ucs_crc32c_long[4][256];
+static uint32_t ucs_crc32c_short[4][256];
+#endif
+
+static uint32_t ucs_crc32c_sw(uint32_t prev_crc, const void *buffer,
+                              size_t size);
+
+static uint32_t (*ucs_crc32c_func)(uint32_t prev_crc, const void *buffer,
+                                   size_t size) = ucs_crc32c_sw;
+
+
+static uint32_t ucs_crc32c_sw(uint32_t prev_crc, const void *buffer,
+                              size_t size)
+{
+    const uint8_t *p = buffer;
+    uint32_t crc     = ~prev_crc;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t word;
+
+    for (; (size > 0) && ((uintptr_t)p & 7); --size, ++p) {
+        crc = ucs_crc32c_table[0][(crc ^ *p) & 0xff] ^ (crc >> 8);
+    }
+
+    for (; size >= sizeof(word); size -= sizeof(word), p += sizeof(word)) {
+        word = crc ^ *(const uint64_t*)p;
+        crc  = ucs_crc32c_table[7][word & 0xff] ^
+               ucs_crc32c_table[6][(word >> 8) & 0xff] ^
+               ucs_crc32c_table[5][(word >> 16) & 0xff] ^
+               ucs_crc32c_table[4][(word >> 24) & 0xff] ^
+               ucs_crc32c_table[3][(word >> 32) & 0xff] ^
+               ucs_crc32c_table[2][(word >> 40) & 0xff] ^
+               ucs_crc32c_table[1][(word >> 48) & 0xff] ^
+               ucs_crc32c_table[0][word >> 56];
+    }
+#endif
+
+    for (; size > 0; --size, ++p) {
+        crc = ucs_crc32c_table[0][(crc ^ *p) & 0xff] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+#if UCS_CRC32C_HW
+/* Multiply a GF(2) 32x32 matrix by a vector */
+static uint32_t ucs_crc32c_gf2_times(const uint32_t *mat, uint32_t vec)
+{
+    uint32_t sum = 0;
+
+    for (; vec != 0; vec >>= 1, ++mat) {
+        if (vec & 1) {
+            sum ^= *mat;
+        }
+    }
+
+    return sum;
+}
+
+static void ucs_crc32c_gf2_square(uint32_t *square, const uint32_t *mat)
+{
+    int n;
+
+    for (n = 0; n < 32; ++n) {
+        square[n] = ucs_crc32c_gf2_times(mat, mat[n]);
+    }
+}
+
+/* Build the operator which applies @a length zero bytes to a CRC32C value */
+static void ucs_crc32c_zeros_op(uint32_t *even, size_t length)
+{
+    uint32_t odd[32];
+    uint32_t row;
+    int n;
+
+    /* Operator for a single zero bit */
+    odd[0] = UCS_CRC32C_POLY;
+    for (n = 1, row = 1; n < 32; ++n, row <<= 1) {
+        odd[n] = row;
+    }
+
+    /* Square twice to get the operators for 2 and 4 zero bits */
+    ucs_crc32c_gf2_square(even, odd);
+    ucs_crc32c_gf2_square(odd, even);
+
+    /* Apply the operators for 1, 2, 4, ... zero bytes as set in length */
+    do {
+        ucs_crc32c_gf2_square(even, odd);
+        length >>= 1;
+        if (length == 0) {
+            return;
+        }
+
+        ucs_crc32c_gf2_square(odd, even);
+        length >>= 1;
+    } while (length != 0);
+
+    memcpy(even, odd, sizeof(odd));
+}
+
+static void ucs_crc32c_zeros_init(uint32_t zeros[][256], size_t length)
+{
+    uint32_t op[32];
+    uint32_t n;
+
+    ucs_crc32c_zeros_op(op, length);
+    for (n = 0; n < 256; ++n) {
+        zeros[0][n] = ucs_crc32c_gf2_times(op, n);
+        zeros[1][n] = ucs_crc32c_gf2_times(op, n << 8);
+        zeros[2][n] = ucs_crc32c_gf2_times(op, n << 16);
+        zeros[3][n] = ucs_crc32c_gf2_times(op, n << 24);
+    }
+}
+
+static UCS_F_ALWAYS_INLINE uint32_t
+ucs_crc32c_shift(uint32_t zeros[][256], uint32_t crc)
+{
+    return zeros[0][crc & 0xff] ^ zeros[1][(crc >> 8) & 0xff] ^
+           zeros[2][(crc >> 16) & 0xff] ^ zeros[3][crc >> 24];
+}
+
+static UCS_CRC32C_HW_ATTR uint32_t
+ucs_crc32c_hw(uint32_t prev_crc, const void *buffer, size_t size)
+{
+    const uint8_t *p = buffer;
+    uint64_t crc0    = ~prev_crc;
+    uint64_t crc1, crc2;
+    const uint8_t *end;
+
+    for (; (size > 0) && ((uintptr_t)p & 7); --size, ++p) {
+        crc0 = UCS_CRC32C_HW_U8(crc0, *p);
+    }
+
+    for (; size >= (UCS_CRC32C_LONG * 3); size -= UCS_CRC32C_LONG * 3) {
+        crc1 = 0;
+        crc2 = 0;
+        for (end = p + UCS_CRC32C_LONG; p < end; p += sizeof(uint64_t)) {
+            crc0 = UCS_CRC32C_HW_U64(crc0, *(const uint64_t*)p);
+            crc1 = UCS_CRC32C_HW_U64(crc1, *(const uint64_t*)
+                                     (p + UCS_CRC32C_LONG));
+            crc2 = UCS_CRC32C_HW_U64(crc2, *(const uint64_t*)
+                                     (p + (UCS_CRC32C_LONG * 2)));
+        }
+        crc0 = ucs_crc32c_shift(ucs_crc32c_long, crc0) ^ crc1;
+        crc0 = ucs_crc32c_shift(ucs_crc32c_long, crc0) ^ crc2;
+        p   += UCS_CRC32C_LONG * 2;
+    }
+
+    for (; size >= (UCS_CRC32C_SHORT * 3); size -= UCS_CRC32C_SHORT * 3) {
+        crc1 = 0;
+        crc2 = 0;
+        for (end = p + UCS_CRC32C_SHORT; p < end; p += sizeof(uint64_t)) {
+            crc0 = UCS_CRC32C_HW_U64(crc0, *(const uint64_t*)p);
+            crc1 = UCS_CRC32C_HW_U64(crc1, *(const uint64_t*)
+                                     (p + UCS_CRC32C_SHORT));
+            crc2 = UCS_CRC32C_HW_U64(crc2, *(const uint64_t*)
+                                     (p + (UCS_CRC32C_SHORT * 2)));
+        }
+        crc0 = ucs_crc32c_shift(ucs_crc32c_short, crc0) ^ crc1;
+        crc0 = ucs_crc32c_shift(ucs_crc32c_short, crc0) ^ crc2;
+        p   += UCS_CRC32C_SHORT * 2;
+    }
+
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t)) {
+        crc0 = UCS_CRC32C_HW_U64(crc0, *(const uint64_t*)p);
+        p   += sizeof(uint64_t);
+    }
+
+    for (; size > 0; --size, ++p) {
+        crc0 = UCS_CRC32C_HW_U8(crc0, *p);
+    }
+
+    return ~(uint32_t)crc0;
+}
+
+static int ucs_crc32c_hw_is_supported()
+{
+#if defined(__x86_64__)
+    return !!(ucs_arch_get_cpu_flag() & UCS_CPU_FLAG_SSE42);
+#else
+    return !!(getauxval(AT_HWCAP) & HWCAP_CRC32);
+#endif
+}
+#endif
+
+uint32_t ucs_crc32c(uint32_t prev_crc, const void *buffer, size_t size)
+{
+    return ucs_crc32c_func(prev_crc, buffer, size);
+}
+
+UCS_STATIC_INIT
+{
+    uint32_t crc, n;
+    int k;
+
+    for (n = 0; n < 256; ++n) {
+        crc = n;
+        for (k = 0; k < 8; ++k) {
+            crc = (crc >> 1) ^ (-(int)(crc & 1) & UCS_CRC32C_POLY);
+        }
+        ucs_crc32c_table[0][n] = crc;
+    }
+
+    for (n = 0; n < 256; ++n) {
+        crc = ucs_crc32c_table[0][n];
+        for (k = 1; k < 8; ++k) {
+            crc = ucs_crc32c_table[0][crc & 0xff] ^ (crc >> 8);
+            ucs_crc32c_table[k][n] = crc;
+        }
+    }
+
+#if UCS_CRC32C_HW
+    if (ucs_crc32c_hw_is_supported()) {
+        ucs_crc32c_zeros_init(ucs_crc32c_long, UCS_CRC32C_LONG);
+        ucs_crc32c_zeros_init(ucs_crc32c_short, UCS_CRC32C_SHORT);
+        ucs_crc32c_func = ucs_crc32c_hw;
+    }
+#endif
+}
@@ -48,6 +48,21 @@ uint16_t ucs_crc16_string(const char *s);
  */
 uint32_t ucs_crc32(uint32_t prev_crc, const void *buffer, size_t size);
 
+
+/**
+ * Calculate CRC32C (Castagnoli) of an arbitrary buffer. Uses the CPU crc32
+ * instructions when they are available, and a table-driven implementation
+ * otherwise.
+ *
+ * @param [in]  prev_crc   Initial CRC value, or a result of a previous call to
+ *                         continue the calculation over a following buffer.
+ * @param [in]  buffer     Buffer to compute crc for.
+ * @param [in]  size       Buffer size.
+ *
+ * @return crc32c() function of the buffer.
+ */
+uint32_t ucs_crc32c(uint32_t prev_crc, const void *buffer, size_t size);
+
 END_C_DECLS
 
 #endif
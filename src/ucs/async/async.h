@@ -182,6 +182,27 @@ static inline int ucs_async_check_owner_thread(ucs_async_context_t *async)
     } while (0)
 
 
+/**
+ * Try to block the async handler without waiting for it.
+ *
+ * @param async Event context to block events for.
+ *
+ * @return Nonzero if the context was blocked by the calling thread, zero if it
+ *         is currently blocked by another thread.
+ */
+static inline int ucs_async_try_block(ucs_async_context_t *async)
+{
+    if (async->mode == UCS_ASYNC_MODE_THREAD_SPINLOCK) {
+        return ucs_recursive_spin_trylock(&async->thread.spinlock);
+    } else if (async->mode == UCS_ASYNC_MODE_THREAD_MUTEX) {
+        return ucs_recursive_mutex_try_block(&async->thread.mutex);
+    }
+
+    UCS_ASYNC_BLOCK(async);
+    return 1;
+}
+
+
 #define UCS_ASYNC_THREAD_LOCK_TYPE (RUNNING_ON_VALGRIND ? \
     UCS_ASYNC_MODE_THREAD_MUTEX : UCS_ASYNC_MODE_THREAD_SPINLOCK)
 
@@ -94,6 +94,19 @@ static ucs_config_field_t ucm_global_config_table[] = {
    ucs_offsetof(ucm_global_config_t, enable_dynamic_mmap_thresh),
    UCS_CONFIG_TYPE_BOOL},
 
+  {"MALLOC_ARENAS", "0",
+   "Maximal number of per-thread arenas of the malloc hooks allocator. Each\n"
+   "thread allocates small blocks from its own arena without locking, and\n"
+   "blocks released by other threads are queued to the owner thread. Threads\n"
+   "beyond this number, and large blocks, use the global heap. Arena memory is\n"
+   "reserved once and reused, and is not returned to the OS. 0 disables arenas.",
+   ucs_offsetof(ucm_global_config_t, malloc_arenas), UCS_CONFIG_TYPE_UINT},
+
+  {"MALLOC_ARENA_SIZE", "64m",
+   "Size of virtual memory reserved for each per-thread malloc arena.",
+   ucs_offsetof(ucm_global_config_t, malloc_arena_size),
+   UCS_CONFIG_TYPE_MEMUNITS},
+
   {"DLOPEN_PROCESS_RPATH", "yes",
    "Process RPATH section of caller module during dynamic libraries opening.",
    ucs_offsetof(ucm_global_config_t, dlopen_process_rpath),
@@ -122,6 +122,14 @@ ucs_config_field_t ucs_config_rcache_table[] = {
      "Purge registration cache upon fork",
      ucs_offsetof(ucs_rcache_config_t, purge_on_fork), UCS_CONFIG_TYPE_BOOL},
 
+    {"RCACHE_UFFD_EVENTS", "n",
+     "Learn about unmapped memory from userfaultfd notifications on the\n"
+     "registered memory ranges, instead of intercepting memory calls by UCM\n"
+     "hooks. Regions which userfaultfd cannot watch, such as file mappings,\n"
+     "SysV shared memory or device memory, are not cached. If userfaultfd is\n"
+     "not supported, UCM hooks are used.",
+     ucs_offsetof(ucs_rcache_config_t, uffd_events), UCS_CONFIG_TYPE_BOOL},
+
     {NULL}
 };
 
@@ -201,6 +209,9 @@ void ucs_rcache_set_params(ucs_rcache_params_t *rcache_params,
     rcache_params->max_unreleased     = rcache_config->max_unreleased;
     rcache_params->flags              = !rcache_config->purge_on_fork ? 0 :
                                         UCS_RCACHE_FLAG_PURGE_ON_FORK;
+    if (rcache_config->uffd_events) {
+        rcache_params->flags |= UCS_RCACHE_FLAG_UFFD_EVENTS;
+    }
 }
 
 static size_t ucs_rcache_stat_max_pow2()
@@ -616,32 +627,16 @@ static void ucs_rcache_check_gc_list(ucs_rcache_t *rcache, int drop_lock)
     ucs_spin_unlock(&rcache->lock);
 }
 
-static void ucs_rcache_unmapped_callback(ucm_event_type_t event_type,
-                                         ucm_event_t *event, void *arg)
+void ucs_rcache_unmapped_range(ucs_rcache_t *rcache, ucs_pgt_addr_t start,
+                               ucs_pgt_addr_t end)
 {
-    ucs_rcache_t *rcache = arg;
     ucs_rcache_inv_entry_t *entry;
-    ucs_pgt_addr_t start, end;
-
-    ucs_assert(event_type == UCM_EVENT_VM_UNMAPPED ||
-               event_type == UCM_EVENT_MEM_TYPE_FREE);
 
     if (rcache->unreleased_size > rcache->params.max_unreleased) {
         /* Trigger a cleanup when the pending size exceeds the threshold */
         ucs_async_pipe_push(&ucs_rcache_global_context.pipe);
     }
 
-    if (event_type == UCM_EVENT_VM_UNMAPPED) {
-        start = (uintptr_t)event->vm_unmapped.address;
-        end   = (uintptr_t)event->vm_unmapped.address + event->vm_unmapped.size;
-    } else if(event_type == UCM_EVENT_MEM_TYPE_FREE) {
-        start = (uintptr_t)event->mem_type.address;
-        end   = (uintptr_t)event->mem_type.address + event->mem_type.size;
-    } else {
-        ucs_warn("%s: unknown event type: %x", rcache->name, event_type);
-        return;
-    }
-
     ucs_trace_func("%s: event vm_unmapped 0x%lx..0x%lx", rcache->name, start, end);
 
     /*
@@ -678,6 +673,28 @@ static void ucs_rcache_unmapped_callback(ucm_event_type_t event_type,
     ucs_spin_unlock(&rcache->lock);
 }
 
+static void ucs_rcache_unmapped_callback(ucm_event_type_t event_type,
+                                         ucm_event_t *event, void *arg)
+{
+    ucs_rcache_t *rcache = arg;
+
+    ucs_assert(event_type == UCM_EVENT_VM_UNMAPPED ||
+               event_type == UCM_EVENT_MEM_TYPE_FREE);
+
+    if (event_type == UCM_EVENT_VM_UNMAPPED) {
+        ucs_rcache_unmapped_range(rcache,
+                                  (uintptr_t)event->vm_unmapped.address,
+                                  (uintptr_t)event->vm_unmapped.address +
+                                          event->vm_unmapped.size);
+    } else if(event_type == UCM_EVENT_MEM_TYPE_FREE) {
+        ucs_rcache_unmapped_range(rcache, (uintptr_t)event->mem_type.address,
+                                  (uintptr_t)event->mem_type.address +
+                                          event->mem_type.size);
+    } else {
+        ucs_warn("%s: unknown event type: %x", rcache->name, event_type);
+    }
+}
+
 /* Clear all regions, called only during cleanup without holding the lock */
 static void ucs_rcache_purge(ucs_rcache_t *rcache)
 {
@@ -1054,6 +1071,14 @@ retry:
         ucs_rcache_lru_evict(rcache);
     }
 
+    if ((rcache->params.flags & UCS_RCACHE_FLAG_UFFD_EVENTS) &&
+        (ucs_rcache_uffd_watch(rcache, region->super.start,
+                               region->super.end) != UCS_OK)) {
+        /* Unmap of the region would not be reported, so do not cache it */
+        ucs_rcache_region_invalidate_internal(
+                rcache, region, UCS_RCACHE_REGION_PUT_FLAG_IN_PGTABLE);
+    }
+
     UCS_STATS_UPDATE_COUNTER(rcache->stats, UCS_RCACHE_MISSES, 1);
 
     ucs_rcache_region_trace(rcache, region, "created");
@@ -1083,6 +1108,10 @@ ucs_status_t ucs_rcache_get(ucs_rcache_t *rcache, void *address, size_t length,
     ucs_trace_func("rcache=%s, address=%p, length=%zu", rcache->name, address,
                    length);
 
+    if (ucs_unlikely(rcache->params.flags & UCS_RCACHE_FLAG_UFFD_EVENTS)) {
+        ucs_rcache_uffd_wait_dispatch();
+    }
+
     ucs_rw_spinlock_read_lock(&rcache->pgt_lock);
     UCS_STATS_UPDATE_COUNTER(rcache->stats, UCS_RCACHE_GETS, 1);
     if (ucs_queue_is_empty(&rcache->inv_q)) {
@@ -1349,16 +1378,35 @@ static UCS_CLASS_INIT_FUNC(ucs_rcache_t, const ucs_rcache_params_t *params,
 
     ucs_rcache_vfs_init(self);
 
-    status = ucm_set_event_handler(params->ucm_events, params->ucm_event_priority,
+    if ((self->params.flags & UCS_RCACHE_FLAG_UFFD_EVENTS) &&
+        (self->params.ucm_events & UCM_EVENT_VM_UNMAPPED)) {
+        status = ucs_rcache_uffd_init(self);
+        if (status == UCS_OK) {
+            self->params.ucm_events &= ~UCM_EVENT_VM_UNMAPPED;
+        } else {
+            ucs_diag("%s: userfaultfd memory events are not supported, using "
+                     "UCM memory hooks", self->name);
+            self->params.flags &= ~UCS_RCACHE_FLAG_UFFD_EVENTS;
+        }
+    } else {
+        self->params.flags &= ~UCS_RCACHE_FLAG_UFFD_EVENTS;
+    }
+
+    status = ucm_set_event_handler(self->params.ucm_events,
+                                   self->params.ucm_event_priority,
                                    ucs_rcache_unmapped_callback, self);
     if (status != UCS_OK) {
         ucs_diag("rcache failed to install UCM event handler: %s",
                  ucs_status_string(status));
-        goto err_remove_vfs;
+        goto err_uffd_cleanup;
     }
 
     return UCS_OK;
 
+err_uffd_cleanup:
+    if (self->params.flags & UCS_RCACHE_FLAG_UFFD_EVENTS) {
+        ucs_rcache_uffd_cleanup(self);
+    }
 err_remove_vfs:
     ucs_vfs_obj_remove(self);
     ucs_rcache_global_list_remove(self);
@@ -1382,6 +1430,9 @@ static UCS_CLASS_CLEANUP_FUNC(ucs_rcache_t)
 {
     ucm_unset_event_handler(self->params.ucm_events, ucs_rcache_unmapped_callback,
                             self);
+    if (self->params.flags & UCS_RCACHE_FLAG_UFFD_EVENTS) {
+        ucs_rcache_uffd_cleanup(self);
+    }
     ucs_vfs_obj_remove(self);
     ucs_rcache_global_list_remove(self);
     ucs_rcache_check_inv_queue(self, 0);
@@ -61,6 +61,9 @@ enum {
     UCS_RCACHE_FLAG_NO_PFN_CHECK  = UCS_BIT(0), /**< PFN check not supported for this rcache */
     UCS_RCACHE_FLAG_PURGE_ON_FORK = UCS_BIT(1), /**< purge rcache on fork */
     UCS_RCACHE_FLAG_SYNC_EVENTS   = UCS_BIT(2), /**< Synchronize memory events handling */
+    UCS_RCACHE_FLAG_UFFD_EVENTS   = UCS_BIT(3), /**< Receive unmap events from
+                                                     userfaultfd instead of UCM,
+                                                     if supported */
 };
 
 /*
@@ -167,6 +170,7 @@ struct ucs_rcache_config {
     size_t        max_size;       /**< Maximal size of mapped memory */
     size_t        max_unreleased; /**< Threshold for triggering a cleanup */
     int           purge_on_fork;  /**< Enable/disable rcache purge on fork */
+    int           uffd_events;    /**< Receive unmap events from userfaultfd */
 };
 
 
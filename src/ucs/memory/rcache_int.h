@@ -106,6 +106,8 @@ struct ucs_rcache {
     UCS_STATS_NODE_DECLARE(stats)
 
     ucs_list_link_t           list; /**< List entry in global ucs_rcache list */
+    ucs_list_link_t           uffd_list; /**< List entry in userfaultfd events
+                                              list, if the events are used */
     ucs_rcache_distribution_t *distribution; /**< Distribution of registration
                                                   cache regions by size */
 };
@@ -133,6 +135,63 @@ void ucs_rcache_atfork_disable();
 size_t ucs_rcache_distribution_get_num_bins();
 
 
+/**
+ * @brief Invalidate the regions in a memory range which was unmapped.
+ *
+ * Can be called from any thread, without holding the registration cache locks.
+ *
+ * @param [in] rcache Registration cache to invalidate the regions in.
+ * @param [in] start  Start address of the unmapped range.
+ * @param [in] end    End address of the unmapped range.
+ */
+void ucs_rcache_unmapped_range(ucs_rcache_t *rcache, ucs_pgt_addr_t start,
+                               ucs_pgt_addr_t end);
+
+
+/**
+ * @brief Start receiving unmap events of the registered memory ranges from
+ *        userfaultfd, instead of UCM memory hooks.
+ *
+ * @param [in] rcache Registration cache which receives the events.
+ *
+ * @return UCS_ERR_UNSUPPORTED if userfaultfd is not available.
+ */
+ucs_status_t ucs_rcache_uffd_init(ucs_rcache_t *rcache);
+
+
+/**
+ * @brief Stop receiving userfaultfd events.
+ *
+ * @param [in] rcache Registration cache which received the events.
+ */
+void ucs_rcache_uffd_cleanup(ucs_rcache_t *rcache);
+
+
+/**
+ * @brief Watch a memory range for unmap events.
+ *
+ * @param [in] rcache Registration cache which receives the events.
+ * @param [in] start  Start address of the range.
+ * @param [in] end    End address of the range.
+ *
+ * @return UCS_ERR_UNSUPPORTED if the range cannot be watched, for example if
+ *         it is not anonymous or shmem-backed memory.
+ */
+ucs_status_t ucs_rcache_uffd_watch(ucs_rcache_t *rcache, ucs_pgt_addr_t start,
+                                   ucs_pgt_addr_t end);
+
+
+/**
+ * @brief Wait until userfaultfd events, which were already read, are passed to
+ *        the registration caches.
+ *
+ * Reading an unmap event lets the unmapping thread continue, so this makes
+ * sure a region in a memory range unmapped by the calling thread is already
+ * invalidated.
+ */
+void ucs_rcache_uffd_wait_dispatch();
+
+
 void ucs_mem_region_destroy_internal(ucs_rcache_t *rcache,
                                      ucs_rcache_region_t *region,
                                      int drop_lock);
@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2025. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "rcache_int.h"
+
+#include <ucs/arch/cpu.h>
+#include <ucs/async/pipe.h>
+#include <ucs/debug/log.h>
+#include <ucs/debug/memtrack_int.h>
+#include <ucs/sys/sys.h>
+
+#ifdef HAVE_LINUX_USERFAULTFD_H
+#include <linux/userfaultfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#endif
+
+
+/* Maximal number of messages to read from userfaultfd at once */
+#define UCS_RCACHE_UFFD_MAX_MSGS 16
+
+
+/*
+ * Thread which reads userfaultfd events.
+ *
+ * Unmap events block the unmapping thread until they are read, so they are
+ * read by a dedicated thread rather than by the UCS async thread, which could
+ * itself release watched memory from an event handler and deadlock.
+ */
+typedef struct {
+    int              fd;     /* userfaultfd file descriptor */
+    ucs_async_pipe_t pipe;   /* Used to stop the thread */
+    pthread_t        thread; /* Thread id */
+} ucs_rcache_uffd_reader_t;
+
+
+/*
+ * Global userfaultfd context, shared by all registration caches which use it.
+ */
+typedef struct {
+    /* Protects access to context members */
+    pthread_mutex_t          lock;
+
+    /* List of registration caches which receive the events */
+    ucs_list_link_t          list;
+
+    /* Events reader, exists while the list is not empty */
+    ucs_rcache_uffd_reader_t *reader;
+
+    /* Set while events are read and dispatched to the caches */
+    volatile int             dispatching;
+} ucs_rcache_uffd_context_t;
+
+
+static ucs_rcache_uffd_context_t ucs_rcache_uffd_context = {
+    .lock        = PTHREAD_MUTEX_INITIALIZER,
+    .list        = UCS_LIST_INITIALIZER(&ucs_rcache_uffd_context.list,
+                                        &ucs_rcache_uffd_context.list),
+    .reader      = NULL,
+    .dispatching = 0
+};
+
+
+#ifdef HAVE_LINUX_USERFAULTFD_H
+
+static void ucs_rcache_uffd_dispatch(int fd)
+{
+    struct uffd_msg msgs[UCS_RCACHE_UFFD_MAX_MSGS];
+    ucs_pgt_addr_t start, end;
+    ucs_rcache_t *rcache;
+    ssize_t ret;
+    size_t i;
+
+    pthread_mutex_lock(&ucs_rcache_uffd_context.lock);
+
+    /* Reading a message releases the unmapping thread, so the flag must be set
+     * before, to let it wait for the invalidation in ucs_rcache_get() */
+    ucs_rcache_uffd_context.dispatching = 1;
+    ucs_memory_cpu_store_fence();
+
+    for (;;) {
+        ret = read(fd, msgs, sizeof(msgs));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            } else if (errno != EAGAIN) {
+                ucs_warn("failed to read from userfaultfd %d: %m", fd);
+            }
+            break;
+        }
+
+        for (i = 0; i < (ret / sizeof(*msgs)); ++i) {
+            switch (msgs[i].event) {
+            case UFFD_EVENT_UNMAP:
+            case UFFD_EVENT_REMOVE:
+                start = msgs[i].arg.remove.start;
+                end   = msgs[i].arg.remove.end;
+                break;
+            case UFFD_EVENT_REMAP:
+                start = msgs[i].arg.remap.from;
+                end   = msgs[i].arg.remap.from + msgs[i].arg.remap.len;
+                break;
+            default:
+                ucs_debug("userfaultfd %d: ignoring event %u", fd,
+                          msgs[i].event);
+                continue;
+            }
+
+            ucs_list_for_each(rcache, &ucs_rcache_uffd_context.list,
+                              uffd_list) {
+                ucs_rcache_unmapped_range(rcache, start, end);
+            }
+        }
+    }
+
+    ucs_memory_cpu_store_fence();
+    ucs_rcache_uffd_context.dispatching = 0;
+
+    pthread_mutex_unlock(&ucs_rcache_uffd_context.lock);
+}
+
+static void *ucs_rcache_uffd_thread_func(void *arg)
+{
+    ucs_rcache_uffd_reader_t *reader = arg;
+    struct pollfd pfds[2];
+    int ret;
+
+    pfds[0].fd     = reader->fd;
+    pfds[0].events = POLLIN;
+    pfds[1].fd     = ucs_async_pipe_rfd(&reader->pipe);
+    pfds[1].events = POLLIN;
+
+    for (;;) {
+        ret = poll(pfds, 2, -1);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            ucs_error("poll on userfaultfd %d failed: %m", reader->fd);
+            break;
+        }
+
+        if (pfds[1].revents != 0) {
+            break;
+        }
+
+        if (pfds[0].revents & POLLIN) {
+            ucs_rcache_uffd_dispatch(reader->fd);
+        }
+    }
+
+    return NULL;
+}
+
+static int ucs_rcache_uffd_create()
+{
+    int fd;
+
+#ifdef UFFD_USER_MODE_ONLY
+    /* Does not require privileges, since only unmap events are needed */
+    fd = syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY);
+    if (fd >= 0) {
+        return fd;
+    }
+#endif
+
+    fd = syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) {
+        ucs_debug("userfaultfd() failed: %m");
+    }
+
+    return fd;
+}
+
+static ucs_status_t ucs_rcache_uffd_open(int *fd_p)
+{
+    /* Write-protect mode is used to register ranges without intercepting
+     * page faults, since no page is ever write-protected */
+    uint64_t features = UFFD_FEATURE_EVENT_UNMAP | UFFD_FEATURE_EVENT_REMOVE |
+                        UFFD_FEATURE_EVENT_REMAP |
+                        UFFD_FEATURE_PAGEFAULT_FLAG_WP;
+    struct uffdio_api api;
+    int fd;
+
+    /* The API handshake can be done only once per file descriptor, so query
+     * the supported features on a separate one */
+    fd = ucs_rcache_uffd_create();
+    if (fd < 0) {
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    api.api      = UFFD_API;
+    api.features = 0;
+    if (ioctl(fd, UFFDIO_API, &api) < 0) {
+        ucs_debug("userfaultfd %d: UFFDIO_API failed: %m", fd);
+        close(fd);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    close(fd);
+
+    if (!ucs_test_all_flags(api.features, features)) {
+        ucs_debug("userfaultfd features 0x%" PRIx64 " do not include 0x%" PRIx64,
+                  (uint64_t)api.features, features);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+#ifdef UFFD_FEATURE_WP_HUGETLBFS_SHMEM
+    /* Allows watching shared memory, such as memory allocated by shm MDs */
+    features |= api.features & UFFD_FEATURE_WP_HUGETLBFS_SHMEM;
+#endif
+
+    fd = ucs_rcache_uffd_create();
+    if (fd < 0) {
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    api.api      = UFFD_API;
+    api.features = features;
+    if (ioctl(fd, UFFDIO_API, &api) < 0) {
+        ucs_debug("userfaultfd %d: UFFDIO_API failed: %m", fd);
+        close(fd);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    *fd_p = fd;
+    return UCS_OK;
+}
+
+static ucs_status_t ucs_rcache_uffd_start(ucs_rcache_uffd_reader_t **reader_p)
+{
+    ucs_rcache_uffd_reader_t *reader;
+    ucs_status_t status;
+
+    reader = ucs_malloc(sizeof(*reader), "rcache_uffd_reader");
+    if (reader == NULL) {
+        return UCS_ERR_NO_MEMORY;
+    }
+
+    status = ucs_rcache_uffd_open(&reader->fd);
+    if (status != UCS_OK) {
+        goto err_free;
+    }
+
+    status = ucs_async_pipe_create(&reader->pipe);
+    if (status != UCS_OK) {
+        goto err_close;
+    }
+
+    status = ucs_pthread_create(&reader->thread, ucs_rcache_uffd_thread_func,
+                                reader, "rcache_uffd");
+    if (status != UCS_OK) {
+        goto err_destroy_pipe;
+    }
+
+    ucs_debug("started reading memory events from userfaultfd %d", reader->fd);
+    *reader_p = reader;
+    return UCS_OK;
+
+err_destroy_pipe:
+    ucs_async_pipe_destroy(&reader->pipe);
+err_close:
+    close(reader->fd);
+err_free:
+    ucs_free(reader);
+    return status;
+}
+
+static void ucs_rcache_uffd_stop(ucs_rcache_uffd_reader_t *reader)
+{
+    ucs_async_pipe_push(&reader->pipe);
+    pthread_join(reader->thread, NULL);
+    ucs_async_pipe_destroy(&reader->pipe);
+
+    /* Closing the file descriptor unregisters all the ranges */
+    close(reader->fd);
+    ucs_free(reader);
+}
+
+ucs_status_t ucs_rcache_uffd_watch(ucs_rcache_t *rcache, ucs_pgt_addr_t start,
+                                   ucs_pgt_addr_t end)
+{
+    struct uffdio_register reg;
+    size_t page_size = ucs_get_page_size();
+
+    reg.range.start = ucs_align_down_pow2(start, page_size);
+    reg.range.len   = ucs_align_up_pow2(end, page_size) - reg.range.start;
+    reg.mode        = UFFDIO_REGISTER_MODE_WP;
+
+    /* Registering an already watched range is allowed and does nothing */
+    if (ioctl(ucs_rcache_uffd_context.reader->fd, UFFDIO_REGISTER, &reg) < 0) {
+        ucs_debug("%s: failed to watch 0x%lx..0x%lx by userfaultfd: %m",
+                  rcache->name, start, end);
+        return UCS_ERR_UNSUPPORTED;
+    }
+
+    return UCS_OK;
+}
+
+#else
+
+static ucs_status_t ucs_rcache_uffd_start(ucs_rcache_uffd_reader_t **reader_p)
+{
+    return UCS_ERR_UNSUPPORTED;
+}
+
+static void ucs_rcache_uffd_stop(ucs_rcache_uffd_reader_t *reader)
+{
+}
+
+ucs_status_t ucs_rcache_uffd_watch(ucs_rcache_t *rcache, ucs_pgt_addr_t start,
+                                   ucs_pgt_addr_t end)
+{
+    return UCS_ERR_UNSUPPORTED;
+}
+
+#endif
+
+ucs_status_t ucs_rcache_uffd_init(ucs_rcache_t *rcache)
+{
+    ucs_status_t status = UCS_OK;
+
+    pthread_mutex_lock(&ucs_rcache_uffd_context.lock);
+    if (ucs_list_is_empty(&ucs_rcache_uffd_context.list)) {
+        status = ucs_rcache_uffd_start(&ucs_rcache_uffd_context.reader);
+        if (status != UCS_OK) {
+            goto out;
+        }
+    }
+
+    ucs_list_add_tail(&ucs_rcache_uffd_context.list, &rcache->uffd_list);
+out:
+    pthread_mutex_unlock(&ucs_rcache_uffd_context.lock);
+    return status;
+}
+
+void ucs_rcache_uffd_cleanup(ucs_rcache_t *rcache)
+{
+    ucs_rcache_uffd_reader_t *reader;
+
+    pthread_mutex_lock(&ucs_rcache_uffd_context.lock);
+    ucs_list_del(&rcache->uffd_list);
+    if (!ucs_list_is_empty(&ucs_rcache_uffd_context.list)) {
+        pthread_mutex_unlock(&ucs_rcache_uffd_context.lock);
+        return;
+    }
+
+    reader                         = ucs_rcache_uffd_context.reader;
+    ucs_rcache_uffd_context.reader = NULL;
+    pthread_mutex_unlock(&ucs_rcache_uffd_context.lock);
+
+    /* Stop the thread without holding the lock, since it may be waiting for
+     * the lock to dispatch events */
+    ucs_rcache_uffd_stop(reader);
+}
+
+void ucs_rcache_uffd_wait_dispatch()
+{
+    while (ucs_rcache_uffd_context.dispatching) {
+        ucs_cpu_relax();
+    }
+
+    ucs_memory_cpu_load_fence();
+}
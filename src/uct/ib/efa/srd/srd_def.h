@@ -75,6 +75,7 @@ struct uct_srd_send_op {
     uct_srd_ep_t           *ep;        /* Sender EP */
     uct_completion_t       *user_comp; /* User completion, NULL if none */
     uct_srd_send_op_comp_t comp_cb;    /* Send operation completion */
+    ucs_time_t             send_time;  /* Post time, for congestion control */
 } UCS_V_ALIGNED(UCT_SRD_SEND_OP_ALIGN);
 
 
@@ -13,6 +13,8 @@
 #include "srd_iface.h"
 
 #include <uct/ib/base/ib_log.h>
+#include <ucs/vfs/base/vfs_cb.h>
+#include <ucs/vfs/base/vfs_obj.h>
 
 
 int uct_srd_ep_is_connected(const uct_ep_h tl_ep,
@@ -58,6 +60,12 @@ static UCS_CLASS_INIT_FUNC(uct_srd_ep_t, const uct_ep_params_t *params)
     self->psn        = UCT_SRD_INITIAL_PSN;
     self->flags      = 0;
     self->dest_qpn   = uct_ib_unpack_uint24(if_addr->qp_num);
+    self->inflight   = 0;
+
+    if (uct_ud_cc_is_enabled(&iface->config.cc)) {
+        self->flags |= UCT_SRD_EP_FLAG_CC;
+        uct_ud_cc_init(&iface->config.cc, &self->cc);
+    }
 
     ucs_arbiter_group_init(&self->pending_group);
     ucs_list_head_init(&self->outstanding_list);
@@ -128,6 +136,20 @@ uct_srd_ep_send_op_complete(uct_srd_send_op_t *send_op, uct_srd_iface_t *iface,
     iface->tx.outstanding--;
 }
 
+/* Completion latency is used as RTT: SRD acknowledges sends in hardware */
+static void uct_srd_ep_cc_ack(uct_srd_iface_t *iface, uct_srd_ep_t *ep,
+                              uct_srd_send_op_t *send_op)
+{
+    ucs_time_t now = ucs_get_time();
+
+    ucs_assertv(ep->inflight > 0, "ep=%p", ep);
+    ep->inflight--;
+    uct_ud_cc_ack(&iface->config.cc, &ep->cc, now - send_op->send_time, 1,
+                  now);
+    /* Window could be reopened, dispatched by the progress */
+    ucs_arbiter_group_schedule(&iface->tx.pending_q, &ep->pending_group);
+}
+
 void uct_srd_ep_send_op_completion(uct_srd_send_op_t *send_op)
 {
     uct_srd_ep_t *ep = send_op->ep;
@@ -145,6 +167,10 @@ void uct_srd_ep_send_op_completion(uct_srd_send_op_t *send_op)
     comp_status = (ep->flags & UCT_SRD_EP_FLAG_CANCELED)?
                   UCS_ERR_CANCELED : UCS_OK;
 
+    if (ucs_unlikely(ep->flags & UCT_SRD_EP_FLAG_CC)) {
+        uct_srd_ep_cc_ack(iface, ep, send_op);
+    }
+
     uct_srd_ep_send_op_complete(send_op, iface, comp_status);
 
     /* Trigger all front line flush completions */
@@ -211,6 +237,13 @@ void uct_srd_ep_send_op_purge(uct_srd_ep_t *ep)
 
     ucs_list_splice_tail(&iface->tx.outstanding_list, &ep->outstanding_list);
     ucs_list_head_init(&ep->outstanding_list);
+    ep->inflight = 0;
+}
+
+static int uct_srd_ep_cc_can_tx(uct_srd_ep_t *ep)
+{
+    return (ep->inflight < uct_ud_cc_window(&ep->cc)) &&
+           !uct_ud_cc_is_paced(&ep->cc, ucs_get_time());
 }
 
 static UCS_F_ALWAYS_INLINE int
@@ -221,7 +254,17 @@ uct_srd_ep_can_tx(uct_srd_ep_t *ep)
             !(ep->flags & UCT_SRD_EP_FLAG_RMA)) &&
            /* Endpoint fencing */
            (!(ep->flags & UCT_SRD_EP_FLAG_FENCE) ||
-             ucs_list_is_empty(&ep->outstanding_list));
+             ucs_list_is_empty(&ep->outstanding_list)) &&
+           /* Congestion window and pacing */
+           (ucs_likely(!(ep->flags & UCT_SRD_EP_FLAG_CC)) ||
+            uct_srd_ep_cc_can_tx(ep));
+}
+
+/* Paced endpoint is not rescheduled by a completion, keep it on the arbiter */
+static UCS_F_ALWAYS_INLINE int uct_srd_ep_is_paced(uct_srd_ep_t *ep)
+{
+    return (ep->flags & UCT_SRD_EP_FLAG_CC) &&
+           uct_ud_cc_is_paced(&ep->cc, ucs_get_time());
 }
 
 ucs_status_t
@@ -236,7 +279,7 @@ uct_srd_ep_pending_add(uct_ep_h tl_ep, uct_pending_req_t *req, unsigned flags)
     }
 
     uct_pending_req_arb_group_push(&ep->pending_group, req);
-    if (uct_srd_ep_can_tx(ep)) {
+    if (uct_srd_ep_can_tx(ep) || uct_srd_ep_is_paced(ep)) {
         ucs_arbiter_group_schedule(&iface->tx.pending_q, &ep->pending_group);
     }
 
@@ -263,7 +306,8 @@ uct_srd_ep_do_pending(ucs_arbiter_t *arbiter, ucs_arbiter_group_t *group,
     }
 
     if (!uct_srd_ep_can_tx(ep)) {
-        return UCS_ARBITER_CB_RESULT_DESCHED_GROUP;
+        return uct_srd_ep_is_paced(ep) ? UCS_ARBITER_CB_RESULT_RESCHED_GROUP :
+                                         UCS_ARBITER_CB_RESULT_DESCHED_GROUP;
     }
 
     ucs_trace_data("iface=%p ep=%p progressing pending request %p", iface, ep,
@@ -351,6 +395,16 @@ static UCS_F_ALWAYS_INLINE void uct_srd_ep_posted(uct_srd_iface_t *iface,
     iface->tx.outstanding++;
 }
 
+static UCS_F_ALWAYS_INLINE void
+uct_srd_ep_cc_posted(uct_srd_ep_t *ep, uct_srd_send_op_t *send_op)
+{
+    if (ucs_unlikely(ep->flags & UCT_SRD_EP_FLAG_CC)) {
+        send_op->send_time = ucs_get_time();
+        ep->inflight++;
+        uct_ud_cc_sent(&ep->cc, send_op->send_time);
+    }
+}
+
 static UCS_F_ALWAYS_INLINE void
 uct_srd_ep_hdr_set(const uct_srd_ep_t *ep, uct_srd_hdr_t *neth, uint8_t id)
 {
@@ -403,6 +457,7 @@ uct_srd_ep_post_send(uct_srd_iface_t *iface, uct_srd_ep_t *ep,
     uct_srd_iface_post_send(iface, ep->ah, ep->dest_qpn, wr, send_flags);
     ep->psn++;
     uct_srd_ep_posted(iface, ep, send_op);
+    uct_srd_ep_cc_posted(ep, send_op);
     iface->tx.available--;
 }
 
@@ -601,6 +656,7 @@ uct_srd_ep_post_rma(uct_srd_iface_t *iface, uct_srd_ep_t *ep, int is_read,
     }
 
     uct_srd_ep_posted(iface, ep, send_op);
+    uct_srd_ep_cc_posted(ep, send_op);
     iface->tx.available--;
     return UCS_INPROGRESS;
 #else
@@ -827,3 +883,20 @@ out:
     UCT_TL_EP_STAT_FLUSH_WAIT(&ep->super);
     return UCS_INPROGRESS;
 }
+
+void uct_srd_ep_vfs_populate(uct_srd_ep_t *ep)
+{
+    uct_srd_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                            uct_srd_iface_t);
+
+    ucs_vfs_obj_add_dir(iface, ep, "ep/%p", ep);
+    ucs_vfs_obj_add_ro_file(ep, ucs_vfs_show_primitive, &ep->flags,
+                            UCS_VFS_TYPE_U32_HEX, "flags");
+    ucs_vfs_obj_add_ro_file(ep, ucs_vfs_show_primitive, &ep->psn,
+                            UCS_VFS_TYPE_U16, "tx/psn");
+    ucs_vfs_obj_add_ro_file(ep, ucs_vfs_show_primitive, &ep->inflight,
+                            UCS_VFS_TYPE_U32, "tx/inflight");
+    if (ep->flags & UCT_SRD_EP_FLAG_CC) {
+        uct_ud_cc_vfs_populate(&ep->cc, ep);
+    }
+}
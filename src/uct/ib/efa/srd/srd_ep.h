@@ -9,6 +9,8 @@
 
 #include "srd_def.h"
 
+#include <uct/ib/ud/base/ud_cc.h>
+
 
 typedef enum uct_srd_ep_flag {
     UCT_SRD_EP_FLAG_CANCELED    = UCS_BIT(0), /* Endpoint was flush canceled */
@@ -16,7 +18,8 @@ typedef enum uct_srd_ep_flag {
     UCT_SRD_EP_FLAG_FENCE       = UCS_BIT(2), /* EP fence operation requested */
     UCT_SRD_EP_FLAG_ERR_HANDLER_INVOKED
                                 = UCS_BIT(3), /* EP error handler was invoked */
-    UCT_SRD_EP_FLAG_RMA         = UCS_BIT(4)  /* Endpoint has seen RMA post */
+    UCT_SRD_EP_FLAG_RMA         = UCS_BIT(4), /* Endpoint has seen RMA post */
+    UCT_SRD_EP_FLAG_CC          = UCS_BIT(5)  /* Congestion control enabled */
 } uct_srd_ep_flag_t;
 
 
@@ -30,6 +33,8 @@ typedef struct uct_srd_ep {
     uint8_t             path_index;
     ucs_arbiter_group_t pending_group;    /* Queue of pending requests */
     ucs_list_link_t     outstanding_list; /* Ordered outstanding list */
+    unsigned            inflight;         /* Posted and not completed sends */
+    uct_ud_cc_t         cc;               /* Congestion control state */
 } uct_srd_ep_t;
 
 
@@ -69,6 +74,8 @@ void uct_srd_ep_send_op_purge(uct_srd_ep_t *ep);
 
 void uct_srd_ep_send_op_completion(uct_srd_send_op_t *send_op);
 
+void uct_srd_ep_vfs_populate(uct_srd_ep_t *ep);
+
 ucs_status_t
 uct_srd_ep_pending_add(uct_ep_h tl_ep, uct_pending_req_t *req, unsigned flags);
 void uct_srd_ep_pending_purge(uct_ep_h ep, uct_pending_purge_callback_t cb,
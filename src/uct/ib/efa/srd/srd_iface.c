@@ -221,12 +221,21 @@ static void uct_srd_iface_handle_failure(uct_ib_iface_t *ib_iface, void *arg,
     UCT_IB_IFACE_VERBS_COMPLETION_LOG(log_lvl, "send", &iface->super, 0, wc);
 }
 
+static void uct_srd_iface_vfs_refresh(uct_iface_h tl_iface)
+{
+    uct_srd_iface_t *iface = ucs_derived_of(tl_iface, uct_srd_iface_t);
+    uct_srd_ep_t *ep;
+
+    kh_foreach_value(&iface->ep_hash, ep, {
+        uct_srd_ep_vfs_populate(ep);
+    });
+}
+
 static uct_ib_iface_ops_t uct_srd_iface_ops = {
     .super = {
         .iface_query_v2        = uct_iface_base_query_v2,
         .iface_estimate_perf   = uct_ib_iface_estimate_perf,
-        .iface_vfs_refresh     = (uct_iface_vfs_refresh_func_t)
-            ucs_empty_function,
+        .iface_vfs_refresh     = uct_srd_iface_vfs_refresh,
         .iface_mem_element_pack = (uct_iface_mem_element_pack_func_t)
             ucs_empty_function_return_unsupported,
         .ep_query              = (uct_ep_query_func_t)
@@ -497,6 +506,12 @@ static UCS_CLASS_INIT_FUNC(uct_srd_iface_t, uct_md_h md, uct_worker_h worker,
         goto err_cleanup_stats_node;
     }
 
+    status = uct_ud_cc_params_init(&self->config.cc, &config->cc,
+                                   config->super.tx.queue_len);
+    if (status != UCS_OK) {
+        goto err_cleanup_stats_node;
+    }
+
     ucs_arbiter_init(&self->tx.pending_q);
     ucs_queue_head_init(&self->tx.ctl_queue);
     ucs_list_head_init(&self->tx.outstanding_list);
@@ -617,6 +632,9 @@ ucs_config_field_t uct_srd_iface_config_table[] = {
     {"SRD_", "", NULL, ucs_offsetof(uct_srd_iface_config_t, ud_common),
      UCS_CONFIG_TYPE_TABLE(uct_ud_iface_common_config_table)},
 
+    {"SRD_", "", NULL, ucs_offsetof(uct_srd_iface_config_t, cc),
+     UCS_CONFIG_TYPE_TABLE(uct_ud_cc_config_table)},
+
     {NULL}
 };
 
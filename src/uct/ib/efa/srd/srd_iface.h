@@ -11,6 +11,7 @@
 #include "srd_ep.h"
 
 #include <uct/ib/ud/base/ud_iface_common.h>
+#include <uct/ib/ud/base/ud_cc.h>
 
 #include <ucs/datastruct/khash.h>
 #include <ucs/datastruct/ptr_array.h>
@@ -21,6 +22,7 @@ BEGIN_C_DECLS
 typedef struct uct_srd_iface_config {
     uct_ib_iface_config_t        super;
     uct_ud_iface_common_config_t ud_common;
+    uct_ud_cc_config_t           cc;
 } uct_srd_iface_config_t;
 
 
@@ -95,6 +97,7 @@ typedef struct uct_srd_iface {
         size_t                       max_rdma_sge;
         size_t                       max_rdma_zcopy;
         size_t                       max_rdma_bcopy;
+        uct_ud_cc_params_t           cc;
     } config;
 } uct_srd_iface_t;
 
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2025. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "ud_cc.h"
+
+#include <ucs/debug/log.h>
+#include <ucs/sys/string.h>
+#include <ucs/vfs/base/vfs_cb.h>
+#include <ucs/vfs/base/vfs_obj.h>
+
+
+/* Weight of a new RTT sample in the smoothed RTT, as 1/2^N */
+#define UCT_UD_CC_RTT_SHIFT 3
+
+
+ucs_config_field_t uct_ud_cc_config_table[] = {
+  {"CC", UCT_UD_CC_BUILTIN,
+   "Congestion control algorithm:\n"
+   " builtin - the transport's native policy: additive-increase,\n"
+   "           multiplicative-decrease window on loss for UD, none for SRD.\n"
+   " swift   - delay-based: grow the window while the round-trip time stays\n"
+   "           within CC_TARGET_DELAY of the lowest one observed, and shrink\n"
+   "           it in proportion to the excess delay otherwise. A window below\n"
+   "           one packet paces the endpoint.",
+   ucs_offsetof(uct_ud_cc_config_t, name), UCS_CONFIG_TYPE_STRING},
+
+  {"CC_TARGET_DELAY", "25us",
+   "Queuing delay above the base round-trip time which the delay-based\n"
+   "congestion control tolerates before decreasing the window.",
+   ucs_offsetof(uct_ud_cc_config_t, target_delay), UCS_CONFIG_TYPE_TIME},
+
+  {"CC_AI", "1.0",
+   "Additive window increase of the delay-based congestion control, in\n"
+   "packets per round-trip time.",
+   ucs_offsetof(uct_ud_cc_config_t, ai), UCS_CONFIG_TYPE_DOUBLE},
+
+  {"CC_BETA", "0.8",
+   "Multiplicative window decrease of the delay-based congestion control,\n"
+   "scaled by the relative queuing delay above target.",
+   ucs_offsetof(uct_ud_cc_config_t, beta), UCS_CONFIG_TYPE_DOUBLE},
+
+  {"CC_MAX_MDF", "0.5",
+   "Maximal window decrease of the delay-based congestion control per\n"
+   "round-trip time. Also applied on packet loss.",
+   ucs_offsetof(uct_ud_cc_config_t, max_mdf), UCS_CONFIG_TYPE_DOUBLE},
+
+  {"CC_MIN_WINDOW", "0.01",
+   "Minimal window of the delay-based congestion control, in packets.\n"
+   "A window below one packet is enforced by pacing the endpoint.",
+   ucs_offsetof(uct_ud_cc_config_t, min_cwnd), UCS_CONFIG_TYPE_DOUBLE},
+
+  {NULL}
+};
+
+
+static UCS_F_ALWAYS_INLINE void
+uct_ud_cc_clamp(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc)
+{
+    cc->cwnd = ucs_min(ucs_max(cc->cwnd, params->min_cwnd), params->max_cwnd);
+}
+
+/* Allow at most one decrease per round-trip time */
+static UCS_F_ALWAYS_INLINE int
+uct_ud_cc_can_decrease(const uct_ud_cc_t *cc, ucs_time_t now)
+{
+    return (now - cc->last_decrease) >= cc->rtt;
+}
+
+static void uct_ud_cc_swift_init(const uct_ud_cc_params_t *params,
+                                 uct_ud_cc_t *cc)
+{
+    cc->cwnd = params->max_cwnd;
+}
+
+static void uct_ud_cc_swift_ack(const uct_ud_cc_params_t *params,
+                                uct_ud_cc_t *cc, unsigned acked,
+                                ucs_time_t now)
+{
+    ucs_time_t target = cc->min_rtt + params->target_delay;
+    double mdf;
+
+    if (cc->rtt < target) {
+        /* Grow by 'ai' packets per round-trip time */
+        if (cc->cwnd >= 1.0) {
+            cc->cwnd += (params->ai * acked) / cc->cwnd;
+        } else {
+            cc->cwnd += params->ai * acked;
+        }
+    } else if (uct_ud_cc_can_decrease(cc, now)) {
+        mdf               = params->beta * (double)(cc->rtt - target) /
+                            (double)cc->rtt;
+        cc->cwnd         *= 1.0 - ucs_min(mdf, params->max_mdf);
+        cc->last_decrease = now;
+    }
+
+    uct_ud_cc_clamp(params, cc);
+}
+
+static void uct_ud_cc_swift_loss(const uct_ud_cc_params_t *params,
+                                 uct_ud_cc_t *cc, ucs_time_t now)
+{
+    if (uct_ud_cc_can_decrease(cc, now)) {
+        cc->cwnd         *= 1.0 - params->max_mdf;
+        cc->last_decrease = now;
+        uct_ud_cc_clamp(params, cc);
+    }
+}
+
+static const uct_ud_cc_ops_t uct_ud_cc_swift_ops = {
+    .name = "swift",
+    .init = uct_ud_cc_swift_init,
+    .ack  = uct_ud_cc_swift_ack,
+    .loss = uct_ud_cc_swift_loss
+};
+
+static const uct_ud_cc_ops_t *uct_ud_cc_algorithms[] = {
+    &uct_ud_cc_swift_ops,
+    NULL
+};
+
+ucs_status_t uct_ud_cc_params_init(uct_ud_cc_params_t *params,
+                                   const uct_ud_cc_config_t *config,
+                                   double max_cwnd)
+{
+    const uct_ud_cc_ops_t **ops;
+
+    params->ops          = NULL;
+    params->target_delay = ucs_time_from_sec(config->target_delay);
+    params->ai           = config->ai;
+    params->beta         = config->beta;
+    params->max_mdf      = config->max_mdf;
+    params->min_cwnd     = config->min_cwnd;
+    params->max_cwnd     = max_cwnd;
+
+    if (!strcmp(config->name, UCT_UD_CC_BUILTIN)) {
+        return UCS_OK;
+    }
+
+    for (ops = uct_ud_cc_algorithms; *ops != NULL; ++ops) {
+        if (!strcmp(config->name, (*ops)->name)) {
+            params->ops = *ops;
+            break;
+        }
+    }
+
+    if (params->ops == NULL) {
+        ucs_error("unknown congestion control algorithm '%s'", config->name);
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    if ((config->ai <= 0) || (config->beta <= 0) || (config->beta > 1) ||
+        (config->max_mdf <= 0) || (config->max_mdf >= 1)) {
+        ucs_error("invalid congestion control parameters: ai=%.2f beta=%.2f "
+                  "max_mdf=%.2f (expected ai > 0, 0 < beta <= 1, "
+                  "0 < max_mdf < 1)", config->ai, config->beta,
+                  config->max_mdf);
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    if ((config->min_cwnd <= 0) || (config->min_cwnd > max_cwnd)) {
+        ucs_error("congestion control min window %.2f must be in (0, %.0f]",
+                  config->min_cwnd, max_cwnd);
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    return UCS_OK;
+}
+
+void uct_ud_cc_init(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc)
+{
+    cc->rtt           = 0;
+    cc->min_rtt       = 0;
+    cc->last_decrease = 0;
+    cc->next_send     = 0;
+    params->ops->init(params, cc);
+}
+
+void uct_ud_cc_ack(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc,
+                   ucs_time_t rtt, unsigned acked, ucs_time_t now)
+{
+    if (rtt != 0) {
+        if (cc->rtt == 0) {
+            cc->rtt     = rtt;
+            cc->min_rtt = rtt;
+        } else {
+            cc->rtt     = cc->rtt - (cc->rtt >> UCT_UD_CC_RTT_SHIFT) +
+                          (rtt >> UCT_UD_CC_RTT_SHIFT);
+            cc->min_rtt = ucs_min(cc->min_rtt, rtt);
+        }
+    }
+
+    params->ops->ack(params, cc, acked, now);
+}
+
+void uct_ud_cc_loss(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc,
+                    ucs_time_t now)
+{
+    params->ops->loss(params, cc, now);
+}
+
+static void uct_ud_cc_vfs_show_cwnd(void *obj, ucs_string_buffer_t *strb,
+                                    void *arg_ptr, uint64_t arg_u64)
+{
+    ucs_string_buffer_appendf(strb, "%.3f\n", *(double*)arg_ptr);
+}
+
+static void uct_ud_cc_vfs_show_time(void *obj, ucs_string_buffer_t *strb,
+                                    void *arg_ptr, uint64_t arg_u64)
+{
+    ucs_string_buffer_appendf(strb, "%.3fus\n",
+                              ucs_time_to_usec(*(ucs_time_t*)arg_ptr));
+}
+
+void uct_ud_cc_vfs_populate(uct_ud_cc_t *cc, void *obj)
+{
+    ucs_vfs_obj_add_ro_file(obj, uct_ud_cc_vfs_show_cwnd, &cc->cwnd, 0,
+                            "cc/cwnd");
+    ucs_vfs_obj_add_ro_file(obj, uct_ud_cc_vfs_show_time, &cc->rtt, 0,
+                            "cc/rtt");
+    ucs_vfs_obj_add_ro_file(obj, uct_ud_cc_vfs_show_time, &cc->min_rtt, 0,
+                            "cc/min_rtt");
+}
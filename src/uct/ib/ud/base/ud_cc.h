@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2025. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifndef UCT_UD_CC_H
+#define UCT_UD_CC_H
+
+#include <ucs/config/parser.h>
+#include <ucs/time/time.h>
+
+
+/* Name of the transport's native congestion control policy */
+#define UCT_UD_CC_BUILTIN "builtin"
+
+
+/**
+ * Congestion control configuration, shared by IB datagram transports
+ * (UD and SRD).
+ */
+typedef struct uct_ud_cc_config {
+    char                  *name;
+    double                target_delay;
+    double                ai;
+    double                beta;
+    double                max_mdf;
+    double                min_cwnd;
+} uct_ud_cc_config_t;
+
+
+/**
+ * Per-endpoint congestion control state. The window is counted in packets and
+ * may drop below 1, in which case the endpoint is paced to send one packet
+ * every rtt/cwnd.
+ */
+typedef struct uct_ud_cc {
+    double                cwnd;          /* Congestion window, in packets */
+    ucs_time_t            rtt;           /* Smoothed round-trip time */
+    ucs_time_t            min_rtt;       /* Lowest round-trip time seen */
+    ucs_time_t            last_decrease; /* Time of the last window decrease */
+    ucs_time_t            next_send;     /* Earliest time of the next send */
+} uct_ud_cc_t;
+
+
+typedef struct uct_ud_cc_params uct_ud_cc_params_t;
+
+
+/**
+ * Congestion control algorithm. The transport reports acknowledged packets
+ * and losses, and limits the number of packets in flight by @ref
+ * uct_ud_cc_window.
+ */
+typedef struct uct_ud_cc_ops {
+    const char            *name;
+    void                  (*init)(const uct_ud_cc_params_t *params,
+                                  uct_ud_cc_t *cc);
+    void                  (*ack)(const uct_ud_cc_params_t *params,
+                                 uct_ud_cc_t *cc, unsigned acked,
+                                 ucs_time_t now);
+    void                  (*loss)(const uct_ud_cc_params_t *params,
+                                  uct_ud_cc_t *cc, ucs_time_t now);
+} uct_ud_cc_ops_t;
+
+
+/**
+ * Per-interface congestion control parameters.
+ */
+struct uct_ud_cc_params {
+    const uct_ud_cc_ops_t *ops;          /* NULL for the builtin policy */
+    ucs_time_t            target_delay;  /* Tolerated queuing delay */
+    double                ai;            /* Additive increase per RTT */
+    double                beta;          /* Multiplicative decrease factor */
+    double                max_mdf;       /* Max decrease per RTT */
+    double                min_cwnd;
+    double                max_cwnd;
+};
+
+
+extern ucs_config_field_t uct_ud_cc_config_table[];
+
+
+ucs_status_t uct_ud_cc_params_init(uct_ud_cc_params_t *params,
+                                   const uct_ud_cc_config_t *config,
+                                   double max_cwnd);
+
+void uct_ud_cc_init(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc);
+
+void uct_ud_cc_ack(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc,
+                   ucs_time_t rtt, unsigned acked, ucs_time_t now);
+
+void uct_ud_cc_loss(const uct_ud_cc_params_t *params, uct_ud_cc_t *cc,
+                    ucs_time_t now);
+
+void uct_ud_cc_vfs_populate(uct_ud_cc_t *cc, void *obj);
+
+
+static UCS_F_ALWAYS_INLINE int
+uct_ud_cc_is_enabled(const uct_ud_cc_params_t *params)
+{
+    return params->ops != NULL;
+}
+
+
+/* Number of packets which may be in flight, at least one */
+static UCS_F_ALWAYS_INLINE unsigned uct_ud_cc_window(const uct_ud_cc_t *cc)
+{
+    return (cc->cwnd < 1.0) ? 1 : (unsigned)cc->cwnd;
+}
+
+
+static UCS_F_ALWAYS_INLINE int
+uct_ud_cc_is_paced(const uct_ud_cc_t *cc, ucs_time_t now)
+{
+    return (int64_t)(cc->next_send - now) > 0;
+}
+
+
+/* Account a sent packet; a window below one packet spreads sends over RTT */
+static UCS_F_ALWAYS_INLINE void uct_ud_cc_sent(uct_ud_cc_t *cc, ucs_time_t now)
+{
+    if (ucs_unlikely(cc->cwnd < 1.0)) {
+        cc->next_send = now + (ucs_time_t)(cc->rtt / cc->cwnd);
+    }
+}
+
+#endif
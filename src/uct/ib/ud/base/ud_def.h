@@ -22,7 +22,7 @@
 /* congestion avoidance settings. See ud_ep.h for details */
 #define UCT_UD_CA_AI_VALUE      1   /* window += AI_VALUE */
 #define UCT_UD_CA_MD_FACTOR     2   /* window = window/factor */
-#define UCT_UD_CA_DUP_ACK_CNT   2   /* TODO: not implemented yet */
+#define UCT_UD_CA_DUP_ACK_CNT   2   /* fast resend after N dup NACKs/SACKs */
 #define UCT_UD_RESENDS_PER_ACK  4   /* request per every N resends */
 #define UCT_UD_SKB_ALIGN        UCS_SYS_CACHE_LINE_SIZE
 #define UCT_UD_SKIP_SWEEP       8
@@ -34,6 +34,13 @@
 #define UCT_UD_CA_MIN_WINDOW    2
 #define UCT_UD_CA_MAX_WINDOW    1025
 
+/* number of psns after the first missing one which are reported by a SACK;
+ * out-of-order packets beyond this range are dropped by the receiver */
+#define UCT_UD_SACK_BITS        64
+
+/* maximal number of packets a put/get zero-copy operation is segmented to */
+#define UCT_UD_RMA_MAX_SEGS     16
+
 
 typedef uint16_t                 uct_ud_psn_t;
 #define UCT_UD_PSN_COMPARE       UCS_CIRCULAR_COMPARE16
@@ -57,6 +64,7 @@ enum {
     UCT_UD_PACKET_FLAG_NACK    = UCS_BIT(27),
     UCT_UD_PACKET_FLAG_PUT     = UCS_BIT(28),
     UCT_UD_PACKET_FLAG_CTL     = UCS_BIT(29),
+    UCT_UD_PACKET_FLAG_GET     = UCS_BIT(30),
 
     UCT_UD_PACKET_DEST_ID_MASK = UCS_MASK(UCT_UD_PACKET_DEST_ID_SHIFT)
 };
@@ -74,6 +82,7 @@ E - explicit congestion notification (ecn)
 N - negative acknowledgement
 P - put emulation (will be disabled in the future)
 C - control packet extended header
+G - get request, or get response if P is also set
 
 Active message packet header
 
@@ -87,14 +96,24 @@ Active message packet header
 
 Control packet header
 
- 3   2 2 2 2 2 2 2             1 1
- 1   9 8 7 6 5 4 3             6 5                             0
+ 3 3 2 2 2 2 2 2             1 1
+ 1 0 9 8 7 6 5 4             6 5                               0
 +---------------------------------------------------------------+
-|rsv|C|P|N|E|A|0|            dest_ep_id (24 bit)                |
+|r|G|C|P|N|E|A|0|            dest_ep_id (24 bit)                |
 +---------------------------------------------------------------+
 |       ack_psn (16 bit)        |           psn (16 bit)        |
 +---------------------------------------------------------------+
 
+A NACK packet may be followed by a selective acknowledgement
+(uct_ud_sack_hdr_t): bit i of the bitmap is set if psn ack_psn+2+i was
+received out of order. Peers which do not support SACK ignore the
+payload of a NACK packet.
+
+A put packet (P) is followed by uct_ud_put_hdr_t and the data to write at
+rva. A get request (G) is followed by uct_ud_get_hdr_t; the target replies
+with put packets which also have the G flag set, carrying the data of the
+get requests in the order they were received.
+
     // neth layout in human readable form
     uint32_t           dest_ep_id:24;
     uint8_t            is_am:1;
@@ -105,7 +124,8 @@ Control packet header
             uint8_t nack:1;
             uint8_t put:1;
             uint8_t ctl:1;
-            uint8_t reserved:2;
+            uint8_t get:1;
+            uint8_t reserved:1;
         } ctl;
         struct { // am true
             uint8_t ack_req:1;
@@ -122,6 +142,11 @@ typedef struct uct_ud_neth {
 } UCS_S_PACKED uct_ud_neth_t;
 
 
+typedef struct uct_ud_sack_hdr {
+    uint64_t            bitmap;
+} UCS_S_PACKED uct_ud_sack_hdr_t;
+
+
 #define UCT_UD_RX_HDR_LEN (UCT_IB_GRH_LEN + sizeof(uct_ud_neth_t))
 
 
@@ -130,6 +155,7 @@ enum {
     UCT_UD_SEND_SKB_FLAG_COMP       = UCS_BIT(1), /* This skb contains a completion */
     UCT_UD_SEND_SKB_FLAG_ZCOPY      = UCS_BIT(2), /* This skb contains a zero-copy segment */
     UCT_UD_SEND_SKB_FLAG_RESENDING  = UCS_BIT(3), /* An active control skb refers to this skb */
+    UCT_UD_SEND_SKB_FLAG_SACKED     = UCS_BIT(4), /* Peer selectively acked this skb */
 
 #if UCS_ENABLE_ASSERT
     UCT_UD_SEND_SKB_FLAG_CTL_ACK    = UCS_BIT(5), /* This is a control-ack skb */
@@ -201,6 +227,7 @@ typedef struct uct_ud_recv_skb {
     union {
         struct {
             ucs_frag_list_elem_t     elem;
+            uint32_t                 len;
         } ooo;
         struct {
             ucs_queue_elem_t         queue;
@@ -220,6 +247,13 @@ typedef struct uct_ud_put_hdr {
 } UCS_S_PACKED uct_ud_put_hdr_t;
 
 
+typedef struct uct_ud_get_hdr {
+    uint64_t rva;     /* source address on the target */
+    uint64_t lva;     /* destination address on the initiator */
+    uint32_t length;  /* remaining length */
+} UCS_S_PACKED uct_ud_get_hdr_t;
+
+
 struct uct_ud_iface_addr {
     uct_ib_uint24_t     qp_num;
 };
@@ -56,6 +56,7 @@ static void uct_ud_ep_resend_start(uct_ud_iface_t *iface, uct_ud_ep_t *ep)
     ep->resend.max_psn   = ep->tx.psn - 1;
     ep->resend.psn       = ep->tx.acked_psn + 1;
     ep->resend.pos       = ucs_queue_iter_begin(&ep->tx.window);
+    ep->tx.rtt_time      = 0; /* acks of resent packets are ambiguous */
     uct_ud_ep_ctl_op_add(iface, ep, UCT_UD_EP_OP_RESEND);
 }
 
@@ -88,13 +89,74 @@ uct_ud_ep_resend_ack(uct_ud_iface_t *iface, uct_ud_ep_t *ep)
     }
 }
 
+/* Set the send window from the congestion control window */
+static void uct_ud_ep_cc_update_cwnd(uct_ud_ep_t *ep)
+{
+    ep->ca.cwnd = ucs_min(uct_ud_cc_window(&ep->cc) + 1, ep->ca.wmax);
+}
+
+/* Open the send window unless the pacing interval did not elapse yet */
+static int uct_ud_ep_cc_open_window(uct_ud_ep_t *ep, ucs_time_t now)
+{
+    if (uct_ud_cc_is_paced(&ep->cc, now)) {
+        return 0;
+    }
+
+    ep->flags     &= ~UCT_UD_EP_FLAG_TX_PACED;
+    ep->tx.max_psn = ep->tx.acked_psn + ep->ca.cwnd;
+    return 1;
+}
+
+static void uct_ud_ep_cc_ack(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                             uct_ud_psn_t ack_psn, unsigned acked)
+{
+    ucs_time_t now = ucs_get_time();
+    ucs_time_t rtt = 0;
+
+    if ((ep->tx.rtt_time != 0) &&
+        UCT_UD_PSN_COMPARE(ack_psn, >=, ep->tx.rtt_psn)) {
+        rtt             = now - ep->tx.rtt_time;
+        ep->tx.rtt_time = 0;
+    }
+
+    uct_ud_cc_ack(&iface->config.cc, &ep->cc, rtt, acked, now);
+    uct_ud_ep_cc_update_cwnd(ep);
+    uct_ud_ep_cc_open_window(ep, now);
+}
+
+void uct_ud_ep_cc_sent(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                       uct_ud_send_skb_t *skb, ucs_time_t now)
+{
+    if ((ep->tx.rtt_time == 0) &&
+        (skb->neth->packet_type & UCT_UD_PACKET_FLAG_ACK_REQ)) {
+        ep->tx.rtt_psn  = skb->neth->psn;
+        ep->tx.rtt_time = now;
+    }
+
+    uct_ud_cc_sent(&ep->cc, now);
+    if (uct_ud_cc_is_paced(&ep->cc, now)) {
+        /* Keep the endpoint on the arbiter to reopen the window in time */
+        ep->flags |= UCT_UD_EP_FLAG_TX_PACED;
+        uct_ud_ep_tx_stop(ep);
+        uct_ud_ep_ctl_op_schedule(iface, ep);
+    }
+}
+
 static void uct_ud_ep_ca_drop(uct_ud_ep_t *ep)
 {
+    uct_ud_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                           uct_ud_iface_t);
+
     ucs_debug("ep: %p ca drop@cwnd = %d in flight: %d",
               ep, ep->ca.cwnd, (int)ep->tx.psn-(int)ep->tx.acked_psn-1);
-    ep->ca.cwnd /= UCT_UD_CA_MD_FACTOR;
-    if (ep->ca.cwnd < UCT_UD_CA_MIN_WINDOW) {
-        ep->ca.cwnd = UCT_UD_CA_MIN_WINDOW;
+    if (ucs_unlikely(ep->flags & UCT_UD_EP_FLAG_CC)) {
+        uct_ud_cc_loss(&iface->config.cc, &ep->cc, ucs_get_time());
+        uct_ud_ep_cc_update_cwnd(ep);
+    } else {
+        ep->ca.cwnd /= UCT_UD_CA_MD_FACTOR;
+        if (ep->ca.cwnd < UCT_UD_CA_MIN_WINDOW) {
+            ep->ca.cwnd = UCT_UD_CA_MIN_WINDOW;
+        }
     }
     ep->tx.max_psn    = ep->tx.acked_psn + ep->ca.cwnd;
     if (UCT_UD_PSN_COMPARE(ep->tx.max_psn, >, ep->tx.psn)) {
@@ -118,12 +180,23 @@ static void uct_ud_ep_reset_max_psn(uct_ud_ep_t *ep)
 
 static void uct_ud_ep_reset(uct_ud_ep_t *ep)
 {
+    uct_ud_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                           uct_ud_iface_t);
+
     ep->tx.psn         = UCT_UD_INITIAL_PSN;
     ep->ca.cwnd        = UCT_UD_CA_MIN_WINDOW;
-    ep->ca.wmax        = ucs_derived_of(ep->super.super.iface,
-                                        uct_ud_iface_t)->config.max_window;
+    ep->ca.wmax        = iface->config.max_window;
     ep->tx.acked_psn   = UCT_UD_INITIAL_PSN - 1;
+    ep->tx.dup_acks    = 0;
+    ep->tx.rtt_time    = 0;
     ep->tx.pending.ops = UCT_UD_EP_OP_NONE;
+    ep->flags         &= ~(UCT_UD_EP_FLAG_TX_FAST_RESEND |
+                           UCT_UD_EP_FLAG_TX_PACED);
+    if (uct_ud_cc_is_enabled(&iface->config.cc)) {
+        ep->flags |= UCT_UD_EP_FLAG_CC;
+        uct_ud_cc_init(&iface->config.cc, &ep->cc);
+        uct_ud_ep_cc_update_cwnd(ep);
+    }
     uct_ud_ep_reset_max_psn(ep);
     ucs_queue_head_init(&ep->tx.window);
 
@@ -133,11 +206,31 @@ static void uct_ud_ep_reset(uct_ud_ep_t *ep)
     ep->tx.resend_count  = 0;
     ep->rx_creq_count    = 0;
 
+    uct_ud_ep_ack_delay_cancel(ep);
     ep->rx.acked_psn = UCT_UD_INITIAL_PSN - 1;
-    ucs_frag_list_init(ep->tx.psn-1, &ep->rx.ooo_pkts, 0 /*TODO: ooo support */
+    ucs_frag_list_init(ep->tx.psn-1, &ep->rx.ooo_pkts,
+                       iface->config.sack ? -1 : 0
                        UCS_STATS_ARG(ep->super.stats));
 }
 
+/* Release the out-of-order packets which were not delivered yet */
+static void uct_ud_ep_rx_ooo_purge(uct_ud_ep_t *ep)
+{
+    ucs_frag_list_elem_t *elem;
+    uct_ud_recv_skb_t *skb;
+
+    while ((elem = ucs_frag_list_remove(&ep->rx.ooo_pkts, 1)) != NULL) {
+        skb = ucs_container_of(elem, uct_ud_recv_skb_t, u.ooo.elem);
+        ucs_mpool_put(skb);
+    }
+}
+
+static void uct_ud_ep_rx_ooo_cleanup(uct_ud_ep_t *ep)
+{
+    uct_ud_ep_rx_ooo_purge(ep);
+    ucs_frag_list_cleanup(&ep->rx.ooo_pkts);
+}
+
 static ucs_status_t uct_ud_ep_free_by_timeout(uct_ud_ep_t *ep,
                                               uct_ud_iface_t *iface)
 {
@@ -164,13 +257,36 @@ uct_ud_skb_is_completed(uct_ud_send_skb_t *skb, uct_ud_psn_t ack_psn)
            !(skb->flags & UCT_UD_SEND_SKB_FLAG_RESENDING);
 }
 
+static UCS_F_ALWAYS_INLINE void
+uct_ud_ep_skb_complete(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                       uct_ud_send_skb_t *skb, ucs_status_t status,
+                       int is_async)
+{
+    uct_ud_comp_desc_t *cdesc;
+
+    if (ucs_likely(!(skb->flags & UCT_UD_SEND_SKB_FLAG_COMP))) {
+        /* fast path case: skb without completion callback */
+        uct_ud_skb_release(skb, 1);
+    } else if (ucs_likely(!is_async)) {
+        /* dispatch user completion immediately */
+        cdesc = uct_ud_comp_desc(skb);
+        uct_completion_update_status(cdesc->comp, status);
+        uct_ud_iface_dispatch_comp(iface, cdesc->comp);
+        uct_ud_skb_release(skb, 1);
+    } else {
+        /* Don't call user completion from async context. Instead, put
+         * it on a queue which will be progressed from main thread.
+         */
+        uct_ud_iface_add_async_comp(iface, ep, skb, status);
+    }
+}
+
 static UCS_F_ALWAYS_INLINE void
 uct_ud_ep_window_release_inline(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
                                 uct_ud_psn_t ack_psn, ucs_status_t status,
                                 int is_async, int invalidate_resend)
 {
     uct_ud_send_skb_t *skb;
-    uct_ud_comp_desc_t *cdesc;
 
     ucs_queue_for_each_extract(skb, &ep->tx.window, queue,
                                uct_ud_skb_is_completed(skb, ack_psn)) {
@@ -178,21 +294,7 @@ uct_ud_ep_window_release_inline(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
             ep->resend.pos = ucs_queue_iter_begin(&ep->tx.window);
             ep->resend.psn = ep->tx.acked_psn + 1;
         }
-        if (ucs_likely(!(skb->flags & UCT_UD_SEND_SKB_FLAG_COMP))) {
-            /* fast path case: skb without completion callback */
-            uct_ud_skb_release(skb, 1);
-        } else if (ucs_likely(!is_async)) {
-            /* dispatch user completion immediately */
-            cdesc = uct_ud_comp_desc(skb);
-            uct_completion_update_status(cdesc->comp, status);
-            uct_ud_iface_dispatch_comp(iface, cdesc->comp);
-            uct_ud_skb_release(skb, 1);
-        } else {
-            /* Don't call user completion from async context. Instead, put
-             * it on a queue which will be progressed from main thread.
-             */
-            uct_ud_iface_add_async_comp(iface, ep, skb, status);
-        }
+        uct_ud_ep_skb_complete(iface, ep, skb, status, is_async);
     }
 }
 
@@ -247,6 +349,27 @@ static void uct_ud_ep_purge_outstanding(uct_ud_ep_t *ep)
     ucs_assert_always(ep->tx.resend_count == 0);
 }
 
+/* Complete the outstanding get operations and drop the get requests from the
+ * peer which were not replied yet */
+static void uct_ud_ep_rma_purge(uct_ud_ep_t *ep, ucs_status_t status,
+                                int is_async)
+{
+    uct_ud_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                           uct_ud_iface_t);
+    uct_ud_recv_skb_t *req_skb;
+    uct_ud_send_skb_t *desc;
+
+    ucs_queue_for_each_extract(desc, &ep->tx.get_q, queue, 1) {
+        uct_ud_ep_skb_complete(iface, ep, desc, status, is_async);
+    }
+
+    ucs_queue_for_each_extract(req_skb, &ep->tx.get_resp_q, u.am.queue, 1) {
+        ucs_mpool_put(req_skb);
+    }
+
+    uct_ud_ep_ctl_op_del(ep, UCT_UD_EP_OP_GET_RESP);
+}
+
 static void uct_ud_ep_purge(uct_ud_ep_t *ep, ucs_status_t status)
 {
     uct_ud_iface_t *iface = ucs_derived_of(ep->super.super.iface,
@@ -266,6 +389,7 @@ static void uct_ud_ep_purge(uct_ud_ep_t *ep, ucs_status_t status)
     ep->tx.acked_psn = (uct_ud_psn_t)(ep->tx.psn - 1);
     uct_ud_ep_window_release(ep, status, 0);
     ucs_assert(ucs_queue_is_empty(&ep->tx.window));
+    uct_ud_ep_rma_purge(ep, status, 0);
 }
 
 static unsigned uct_ud_ep_deferred_timeout_handler(void *arg)
@@ -412,6 +536,8 @@ UCS_CLASS_INIT_FUNC(uct_ud_ep_t, uct_ud_iface_t *iface,
 
     self->dest_ep_id = UCT_UD_EP_NULL_ID;
     self->path_index = UCT_EP_PARAMS_GET_PATH_INDEX(params);
+    ucs_queue_head_init(&self->tx.get_q);
+    ucs_queue_head_init(&self->tx.get_resp_q);
     uct_ud_ep_reset(self);
     uct_ud_iface_add_ep(iface, self);
     self->tx.tick = iface->tx.tick;
@@ -485,7 +611,8 @@ static UCS_CLASS_CLEANUP_FUNC(uct_ud_ep_t)
     ucs_wtimer_remove(&iface->tx.timer, &self->timer);
     uct_ud_iface_remove_ep(iface, self);
     uct_ud_iface_cep_remove_ep(iface, self);
-    ucs_frag_list_cleanup(&self->rx.ooo_pkts);
+    uct_ud_ep_rx_ooo_cleanup(self);
+    uct_ud_ep_ack_delay_cancel(self);
 
     ucs_arbiter_group_purge(&iface->tx.pending_q, &self->tx.pending.group,
                             uct_ud_ep_pending_cancel_cb, 0);
@@ -520,7 +647,7 @@ static ucs_status_t uct_ud_ep_connect_to_iface(uct_ud_ep_t *ep,
     uct_ib_device_t *dev  = uct_ib_iface_device(&iface->super);
     char buf[128];
 
-    ucs_frag_list_cleanup(&ep->rx.ooo_pkts);
+    uct_ud_ep_rx_ooo_cleanup(ep);
     uct_ud_ep_reset(ep);
 
     ucs_debug(UCT_IB_IFACE_FMT" lid %d qpn 0x%x epid %u ep %p connected to "
@@ -535,7 +662,7 @@ static ucs_status_t uct_ud_ep_connect_to_iface(uct_ud_ep_t *ep,
 
 static ucs_status_t uct_ud_ep_disconnect_from_iface(uct_ud_ep_t *ep)
 {
-    ucs_frag_list_cleanup(&ep->rx.ooo_pkts);
+    uct_ud_ep_rx_ooo_cleanup(ep);
     uct_ud_ep_reset(ep);
 
     ep->dest_ep_id = UCT_UD_EP_NULL_ID;
@@ -701,7 +828,7 @@ uct_ud_ep_connect_to_ep_v2(uct_ep_h tl_ep,
 
     uct_ud_ep_set_dest_ep_id(ep, uct_ib_unpack_uint24(ep_addr->ep_id));
 
-    ucs_frag_list_cleanup(&ep->rx.ooo_pkts);
+    uct_ud_ep_rx_ooo_cleanup(ep);
     uct_ud_ep_reset(ep);
 
     ucs_debug(UCT_IB_IFACE_FMT" slid %d qpn 0x%x epid %u connected to %s "
@@ -723,19 +850,28 @@ static UCS_F_ALWAYS_INLINE void
 uct_ud_ep_process_ack(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
                       uct_ud_psn_t ack_psn, int is_async)
 {
+    uct_ud_psn_t acked;
+
     /* Ignore duplicate ACK */
     if (ucs_unlikely(UCT_UD_PSN_COMPARE(ack_psn, <=, ep->tx.acked_psn))) {
         return;
     }
 
+    acked            = ack_psn - ep->tx.acked_psn;
     ep->tx.acked_psn = ack_psn;
+    ep->tx.dup_acks  = 0;
+    ep->flags       &= ~UCT_UD_EP_FLAG_TX_FAST_RESEND;
     ucs_assertv(UCT_UD_PSN_COMPARE(ep->tx.acked_psn, <, ep->tx.psn),
                 "ep %p: flags=0x%x acked_psn=%u must be smaller than"
                 " current_psn=%u", ep, ep->flags, ep->tx.acked_psn,
                 ep->tx.psn);
 
     uct_ud_ep_window_release_inline(iface, ep, ack_psn, UCS_OK, is_async, 0);
-    uct_ud_ep_ca_ack(ep);
+    if (ucs_unlikely(ep->flags & UCT_UD_EP_FLAG_CC)) {
+        uct_ud_ep_cc_ack(iface, ep, ack_psn, acked);
+    } else {
+        uct_ud_ep_ca_ack(ep);
+    }
     uct_ud_ep_resend_ack(iface, ep);
 
     ucs_arbiter_group_schedule(&iface->tx.pending_q, &ep->tx.pending.group);
@@ -754,6 +890,65 @@ static inline void uct_ud_ep_rx_put(uct_ud_neth_t *neth, unsigned byte_len)
             byte_len - sizeof(*neth) - sizeof(*put_hdr));
 }
 
+static void uct_ud_ep_rx_get_resp(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                                  uct_ud_neth_t *neth, unsigned byte_len,
+                                  int is_async)
+{
+    uct_ud_put_hdr_t *put_hdr = (uct_ud_put_hdr_t*)(neth + 1);
+    size_t length             = byte_len - sizeof(*neth) - sizeof(*put_hdr);
+    uct_ud_get_hdr_t *get_hdr;
+    uct_ud_send_skb_t *desc;
+
+    if (ucs_unlikely(ucs_queue_is_empty(&ep->tx.get_q))) {
+        ucs_trace_data("ep %p: drop response of canceled get psn %u", ep,
+                       neth->psn);
+        return;
+    }
+
+    /* responses arrive in the order of the get requests */
+    desc    = ucs_queue_head_elem_non_empty(&ep->tx.get_q, uct_ud_send_skb_t,
+                                            queue);
+    get_hdr = (uct_ud_get_hdr_t*)(desc->neth + 1);
+    ucs_assertv((put_hdr->rva == get_hdr->lva) && (length <= get_hdr->length),
+                "ep %p: get response to 0x%"PRIx64" len %zu, expected 0x%"
+                PRIx64" len %u", ep, put_hdr->rva, length, get_hdr->lva,
+                get_hdr->length);
+
+    memcpy((void*)put_hdr->rva, put_hdr + 1, length);
+    get_hdr->lva    += length;
+    get_hdr->length -= length;
+    if (get_hdr->length > 0) {
+        return;
+    }
+
+    ucs_queue_pull_non_empty(&ep->tx.get_q);
+    uct_ud_ep_skb_complete(iface, ep, desc, UCS_OK, is_async);
+    if (ucs_queue_is_empty(&ep->tx.get_q)) {
+        /* a pending flush may wait for the outstanding gets */
+        ucs_arbiter_group_schedule(&iface->tx.pending_q,
+                                   &ep->tx.pending.group);
+    }
+}
+
+static void uct_ud_ep_rx_rma(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                             uct_ud_neth_t *neth, unsigned byte_len,
+                             uct_ud_recv_skb_t *skb, int is_async)
+{
+    if (!(neth->packet_type & UCT_UD_PACKET_FLAG_GET)) {
+        ucs_assert(neth->packet_type & UCT_UD_PACKET_FLAG_PUT);
+        uct_ud_ep_rx_put(neth, byte_len);
+    } else if (neth->packet_type & UCT_UD_PACKET_FLAG_PUT) {
+        uct_ud_ep_rx_get_resp(iface, ep, neth, byte_len, is_async);
+    } else {
+        /* keep the request until all of its data is sent */
+        ucs_queue_push(&ep->tx.get_resp_q, &skb->u.am.queue);
+        uct_ud_ep_ctl_op_add(iface, ep, UCT_UD_EP_OP_GET_RESP);
+        return;
+    }
+
+    ucs_mpool_put(skb);
+}
+
 static uct_ud_ep_t *uct_ud_ep_create_passive(uct_ud_iface_t *iface,
                                              uct_ud_ctl_hdr_t *ctl)
 {
@@ -832,6 +1027,7 @@ static void uct_ud_ep_rx_creq(uct_ud_iface_t *iface, uct_ud_neth_t *neth)
     } else if (ep->dest_ep_id == UCT_UD_EP_NULL_ID) {
         /* simultaneous CREQ */
         uct_ud_ep_set_dest_ep_id(ep, uct_ib_unpack_uint24(ctl->conn_req.ep_addr.ep_id));
+        uct_ud_ep_rx_ooo_purge(ep);
         ep->rx.ooo_pkts.head_sn = neth->psn;
         uct_ud_peer_copy(&ep->peer, ucs_unaligned_ptr(&ctl->peer));
         ucs_debug("simultaneous CREQ ep=%p"
@@ -928,6 +1124,7 @@ static void uct_ud_ep_rx_ctl(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
         return;
     }
 
+    uct_ud_ep_rx_ooo_purge(ep);
     ep->rx.ooo_pkts.head_sn = neth->psn;
     uct_ud_ep_set_dest_ep_id(ep, ctl->conn_rep.src_ep_id);
     ucs_arbiter_group_schedule(&iface->tx.pending_q, &ep->tx.pending.group);
@@ -990,18 +1187,155 @@ uct_ud_send_skb_t *uct_ud_ep_prepare_creq(uct_ud_ep_t *ep)
     return skb;
 }
 
+static void uct_ud_ep_rx_nack(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                              uct_ud_neth_t *neth, unsigned byte_len)
+{
+    uct_ud_sack_hdr_t *sack   = (uct_ud_sack_hdr_t*)(neth + 1);
+    uct_ud_psn_t max_sack_psn = ep->tx.acked_psn;
+    unsigned sack_count       = 0;
+    uct_ud_send_skb_t *skb;
+    uct_ud_psn_t offset;
+
+    uct_ud_ep_set_state(ep, UCT_UD_EP_FLAG_TX_NACKED);
+
+    /* Ignore a NACK which was overtaken by a newer ACK */
+    if (UCT_UD_PSN_COMPARE(neth->ack_psn, !=, ep->tx.acked_psn) ||
+        uct_ud_ep_is_last_ack_received(ep)) {
+        return;
+    }
+
+    if (byte_len >= (sizeof(*neth) + sizeof(*sack))) {
+        /* Mark the packets which the peer already holds, so they would not be
+         * resent */
+        ucs_queue_for_each(skb, &ep->tx.window, queue) {
+            offset = skb->neth->psn - ep->tx.acked_psn - 2;
+            if (offset == (uct_ud_psn_t)-1) {
+                continue; /* first missing psn */
+            } else if (offset >= UCT_UD_SACK_BITS) {
+                break;
+            }
+
+            if (sack->bitmap & UCS_BIT(offset)) {
+                skb->flags  |= UCT_UD_SEND_SKB_FLAG_SACKED;
+                max_sack_psn = skb->neth->psn;
+            }
+        }
+
+        sack_count = ucs_popcount(sack->bitmap);
+    }
+
+    if (ep->tx.dup_acks < UCT_UD_CA_DUP_ACK_CNT) {
+        ++ep->tx.dup_acks;
+    }
+
+    if ((ep->flags & UCT_UD_EP_FLAG_TX_FAST_RESEND) ||
+        uct_ud_ep_ctl_op_check(ep, UCT_UD_EP_OP_RESEND) ||
+        ((ep->tx.dup_acks < UCT_UD_CA_DUP_ACK_CNT) &&
+         (sack_count < UCT_UD_CA_DUP_ACK_CNT))) {
+        return;
+    }
+
+    ucs_trace("ep %p: fast resend acked_psn %u max_sack_psn %u sack_count %u",
+              ep, ep->tx.acked_psn, max_sack_psn, sack_count);
+    uct_ud_ep_set_state(ep, UCT_UD_EP_FLAG_TX_FAST_RESEND);
+    uct_ud_ep_ca_drop(ep);
+    uct_ud_ep_resend_start(iface, ep);
+    if (sack_count > 0) {
+        /* packets after the last SACKed one may be still in flight */
+        ep->resend.max_psn = max_sack_psn;
+    }
+}
+
+static UCS_F_ALWAYS_INLINE void
+uct_ud_ep_rx_deliver(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                     uct_ud_neth_t *neth, unsigned byte_len,
+                     uct_ud_recv_skb_t *skb, int is_async)
+{
+    uint32_t am_id = uct_ud_neth_get_am_id(neth);
+
+    if (ucs_unlikely(!(neth->packet_type & UCT_UD_PACKET_FLAG_AM))) {
+        uct_ud_ep_rx_rma(iface, ep, neth, byte_len, skb, is_async);
+        return;
+    }
+
+    if (ucs_unlikely(is_async &&
+                     !(iface->super.super.am[am_id].flags & UCT_CB_FLAG_ASYNC))) {
+        skb->u.am.len = byte_len - sizeof(*neth);
+        ucs_queue_push(&iface->rx.pending_q, &skb->u.am.queue);
+    } else {
+        /* Avoid reordering with respect to pending operations, if user AM handler
+         * initiates sends from any endpoint created on the iface.
+         * This flag would be cleared after all incoming messages
+         * are processed. */
+        uct_ud_iface_raise_pending_async_ev(iface);
+
+        uct_ib_iface_invoke_am_desc(&iface->super, am_id, neth + 1,
+                                    byte_len - sizeof(*neth), &skb->super);
+    }
+}
+
+/* Deliver the out-of-order packets which became in-order */
+static void
+uct_ud_ep_rx_ooo_pull(uct_ud_iface_t *iface, uct_ud_ep_t *ep, int is_async)
+{
+    ucs_frag_list_elem_t *elem;
+    uct_ud_recv_skb_t *skb;
+    uct_ud_neth_t *neth;
+    void *hdr;
+
+    while ((elem = ucs_frag_list_pull(&ep->rx.ooo_pkts)) != NULL) {
+        skb  = ucs_container_of(elem, uct_ud_recv_skb_t, u.ooo.elem);
+        hdr  = uct_ib_iface_recv_desc_hdr(&iface->super,
+                                          (uct_ib_iface_recv_desc_t*)skb);
+        neth = (uct_ud_neth_t*)UCS_PTR_BYTE_OFFSET(hdr, UCT_IB_GRH_LEN);
+        uct_ud_ep_rx_deliver(iface, ep, neth, skb->u.ooo.len, skb, is_async);
+    }
+}
+
+static UCS_F_ALWAYS_INLINE int
+uct_ud_ep_rx_ack_is_due(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                        const uct_ud_neth_t *neth)
+{
+    return (uct_ud_psn_t)(neth->psn - ep->rx.acked_psn) >=
+           iface->config.ack_coalesce;
+}
+
+static void uct_ud_ep_rx_ack_req(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                                 const uct_ud_neth_t *neth)
+{
+    /* Control packets request an ack when the peer waits for it (flush,
+     * resend timer), so do not delay it */
+    if ((iface->config.ack_delay == 0) ||
+        !(neth->packet_type & (UCT_UD_PACKET_FLAG_AM |
+                               UCT_UD_PACKET_FLAG_PUT |
+                               UCT_UD_PACKET_FLAG_GET)) ||
+        uct_ud_ep_rx_ack_is_due(iface, ep, neth)) {
+        uct_ud_ep_ack_delay_cancel(ep);
+        uct_ud_ep_ctl_op_add(iface, ep, UCT_UD_EP_OP_ACK);
+        ucs_trace_data("ACK_REQ - schedule ack, head_sn=%d sn=%d",
+                       ep->rx.ooo_pkts.head_sn, neth->psn);
+        return;
+    }
+
+    if (ep->rx.ack_time == 0) {
+        ep->rx.ack_time = ucs_get_time() + iface->config.ack_delay;
+        ucs_list_add_tail(&iface->rx.ack_list, &ep->rx.ack_list);
+        ucs_trace_data("ACK_REQ - delay ack, head_sn=%d sn=%d",
+                       ep->rx.ooo_pkts.head_sn, neth->psn);
+    }
+}
+
 void uct_ud_ep_process_rx(uct_ud_iface_t *iface, uct_ud_neth_t *neth, unsigned byte_len,
                           uct_ud_recv_skb_t *skb, int is_async)
 {
     uint32_t dest_id;
-    uint32_t is_am, am_id;
+    uint32_t is_am;
     uct_ud_ep_t *ep = 0; /* todo: check why gcc complaints about uninitialized var */
     ucs_frag_list_ooo_type_t ooo_type;
 
     UCT_UD_IFACE_HOOK_CALL_RX(iface, neth, byte_len);
 
     dest_id = uct_ud_neth_get_dest_id(neth);
-    am_id   = uct_ud_neth_get_am_id(neth);
     is_am   = neth->packet_type & UCT_UD_PACKET_FLAG_AM;
 
     if (ucs_unlikely(dest_id == UCT_UD_EP_NULL_ID)) {
@@ -1024,12 +1358,24 @@ void uct_ud_ep_process_rx(uct_ud_iface_t *iface, uct_ud_neth_t *neth, unsigned b
                 ep->ep_id, dest_id);
     UCT_UD_EP_HOOK_CALL_RX(ep, neth, byte_len);
 
+    if (ucs_unlikely(iface->config.rx_drop_interval &&
+                     (neth->packet_type & (UCT_UD_PACKET_FLAG_AM |
+                                           UCT_UD_PACKET_FLAG_PUT |
+                                           UCT_UD_PACKET_FLAG_GET)) &&
+                     ((++iface->rx.drop_count %
+                       iface->config.rx_drop_interval) == 0))) {
+        ucs_trace_data("ep %p: injected drop of psn %u", ep, neth->psn);
+        goto out;
+    }
+
     uct_ud_ep_process_ack(iface, ep, neth->ack_psn, is_async);
 
     if (ucs_unlikely(neth->packet_type & UCT_UD_PACKET_FLAG_ACK_REQ)) {
+        uct_ud_ep_rx_ack_req(iface, ep, neth);
+    } else if (ucs_unlikely(ep->rx.ack_time != 0) &&
+               uct_ud_ep_rx_ack_is_due(iface, ep, neth)) {
+        uct_ud_ep_ack_delay_cancel(ep);
         uct_ud_ep_ctl_op_add(iface, ep, UCT_UD_EP_OP_ACK);
-        ucs_trace_data("ACK_REQ - schedule ack, head_sn=%d sn=%d",
-                       ep->rx.ooo_pkts.head_sn, neth->psn);
     }
 
     if (ucs_unlikely(UCT_UD_PSN_COMPARE(neth->psn, >, ep->rx.ooo_pkts.head_sn + 1))) {
@@ -1038,7 +1384,7 @@ void uct_ud_ep_process_rx(uct_ud_iface_t *iface, uct_ud_neth_t *neth, unsigned b
 
     if (ucs_unlikely(!is_am)) {
         if (neth->packet_type & UCT_UD_PACKET_FLAG_NACK) {
-            uct_ud_ep_set_state(ep, UCT_UD_EP_FLAG_TX_NACKED);
+            uct_ud_ep_rx_nack(iface, ep, neth, byte_len);
             goto out;
         }
 
@@ -1051,38 +1397,40 @@ void uct_ud_ep_process_rx(uct_ud_iface_t *iface, uct_ud_neth_t *neth, unsigned b
         }
     }
 
-    ooo_type = ucs_frag_list_insert(&ep->rx.ooo_pkts, &skb->u.ooo.elem, neth->psn);
-    if (ucs_unlikely(ooo_type != UCS_FRAG_LIST_INSERT_FAST)) {
-        if ((ooo_type != UCS_FRAG_LIST_INSERT_DUP) &&
-            (ooo_type != UCS_FRAG_LIST_INSERT_FAIL)) {
-            ucs_fatal("Out of order is not implemented: got %d", ooo_type);
-        }
-        ucs_trace_data("DUP/OOB - schedule ack, head_sn=%d sn=%d",
+    /* Out-of-order packets which can not be reported by SACK are dropped */
+    if (ucs_unlikely(UCT_UD_PSN_COMPARE(neth->psn, >,
+                                        ep->rx.ooo_pkts.head_sn +
+                                        UCT_UD_SACK_BITS + 1))) {
+        ucs_trace_data("OOB - drop, head_sn=%d sn=%d",
                        ep->rx.ooo_pkts.head_sn, neth->psn);
         goto out;
     }
 
-    if (ucs_unlikely(!is_am && (neth->packet_type & UCT_UD_PACKET_FLAG_PUT))) {
-        /* TODO: remove once ucp implements put */
-        uct_ud_ep_rx_put(neth, byte_len);
-        goto out;
+    ooo_type = ucs_frag_list_insert(&ep->rx.ooo_pkts, &skb->u.ooo.elem, neth->psn);
+    if (ucs_likely(ooo_type == UCS_FRAG_LIST_INSERT_FAST)) {
+        uct_ud_ep_rx_deliver(iface, ep, neth, byte_len, skb, is_async);
+        return;
     }
 
-    if (ucs_unlikely(is_async &&
-                     !(iface->super.super.am[am_id].flags & UCT_CB_FLAG_ASYNC))) {
-        skb->u.am.len = byte_len - sizeof(*neth);
-        ucs_queue_push(&iface->rx.pending_q, &skb->u.am.queue);
-    } else {
-        /* Avoid reordering with respect to pending operations, if user AM handler
-         * initiates sends from any endpoint created on the iface.
-         * This flag would be cleared after all incoming messages
-         * are processed. */
-        uct_ud_iface_raise_pending_async_ev(iface);
-
-        uct_ib_iface_invoke_am_desc(&iface->super, am_id, neth + 1,
-                                    byte_len - sizeof(*neth), &skb->super);
+    switch (ooo_type) {
+    case UCS_FRAG_LIST_INSERT_FIRST:
+        uct_ud_ep_rx_deliver(iface, ep, neth, byte_len, skb, is_async);
+        uct_ud_ep_rx_ooo_pull(iface, ep, is_async);
+        return;
+    case UCS_FRAG_LIST_INSERT_SLOW:
+        /* keep the packet until the missing ones arrive */
+        skb->u.ooo.len = byte_len;
+        ucs_trace_data("OOO - keep, head_sn=%d sn=%d",
+                       ep->rx.ooo_pkts.head_sn, neth->psn);
+        return;
+    case UCS_FRAG_LIST_INSERT_DUP:
+    case UCS_FRAG_LIST_INSERT_FAIL:
+        ucs_trace_data("DUP/OOB - schedule ack, head_sn=%d sn=%d",
+                       ep->rx.ooo_pkts.head_sn, neth->psn);
+        goto out;
+    default:
+        ucs_fatal("unexpected out of order insert type: %d", ooo_type);
     }
-    return;
 
 out:
     ucs_mpool_put(skb);
@@ -1181,6 +1529,12 @@ ucs_status_t uct_ud_ep_flush_nolock(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
         return UCS_ERR_NO_RESOURCE;
     }
 
+    if (ucs_unlikely(!ucs_queue_is_empty(&ep->tx.get_q))) {
+        /* get is completed by the response data rather than by the window
+         * ack, retry once all gets are completed */
+        return UCS_ERR_NO_RESOURCE;
+    }
+
     if (ucs_queue_is_empty(&ep->tx.window) &&
         ucs_queue_is_empty(&iface->tx.async_comp_q)) {
         /* TX windows is empty and no outstanding operations */
@@ -1226,6 +1580,8 @@ ucs_status_t uct_ud_ep_flush(uct_ep_h ep_h, unsigned flags,
     if (ucs_unlikely(flags & UCT_FLUSH_FLAG_CANCEL)) {
         uct_ud_ep_reset_max_psn(ep);
         ep->tx.acked_psn = (uct_ud_psn_t)(ep->tx.psn - 1);
+        /* complete the gets from the progress, like the window skbs */
+        uct_ud_ep_rma_purge(ep, UCS_ERR_CANCELED, 1);
     }
 
     if (ucs_unlikely(uct_ud_iface_has_pending_async_ev(iface))) {
@@ -1267,6 +1623,158 @@ ucs_status_t uct_ud_ep_check(uct_ep_h tl_ep, unsigned flags, uct_completion_t *c
     return uct_ep_put_short(tl_ep, &dummy, 0, 0, 0);
 }
 
+ucs_status_t uct_ud_ep_put_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
+                                 size_t iovcnt, uint64_t remote_addr,
+                                 uct_rkey_t rkey, uct_completion_t *comp)
+{
+    uct_ud_ep_t *ep       = ucs_derived_of(tl_ep, uct_ud_ep_t);
+    uct_ud_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                           uct_ud_iface_t);
+    size_t seg_len        = uct_ud_iface_rma_seg_len(iface);
+    uct_ud_send_skb_t *skbs[UCT_UD_RMA_MAX_SEGS];
+    unsigned seg, num_segs, is_last;
+    uct_ud_put_hdr_t *put_hdr;
+    uct_ud_zcopy_desc_t *zdesc;
+    uct_ud_send_skb_t *skb;
+    size_t length, offset;
+    uct_iov_t seg_iov;
+
+    UCT_CHECK_IOV_SIZE(iovcnt, 1ul, "uct_ud_ep_put_zcopy");
+    length = uct_iov_total_length(iov, iovcnt);
+    UCT_CHECK_LENGTH(length, 0, seg_len * UCT_UD_RMA_MAX_SEGS, "put_zcopy");
+
+    num_segs = ucs_max(ucs_div_round_up(length, seg_len), 1);
+
+    uct_ud_enter(iface);
+
+    /* Only the first packet has to fit the window, so the put can be sent
+     * even with the minimal window */
+    skb = uct_ud_ep_get_tx_skb(iface, ep);
+    if ((skb == NULL) || (iface->tx.available < (int)num_segs)) {
+        goto err_no_res;
+    }
+
+    /* Take all skbs in advance, so the put is either posted entirely or not
+     * at all. The cached skb is used by the last packet, since it is replaced
+     * by uct_ud_iface_complete_tx_skb() */
+    for (seg = 0; seg < num_segs - 1; ++seg) {
+        skbs[seg] = ucs_mpool_get(&iface->tx.mp);
+        if (skbs[seg] == NULL) {
+            UCT_TL_IFACE_STAT_TX_NO_DESC(&iface->super.super);
+            goto err_release_skbs;
+        }
+
+        VALGRIND_MAKE_MEM_DEFINED(&skbs[seg]->lkey, sizeof(skbs[seg]->lkey));
+        skbs[seg]->flags = 0;
+    }
+    skbs[num_segs - 1] = skb;
+
+    seg_iov.memh   = iov->memh;
+    seg_iov.stride = 0;
+    seg_iov.count  = 1;
+    for (seg = 0, offset = 0; seg < num_segs; ++seg, offset += seg_len) {
+        skb     = skbs[seg];
+        is_last = (seg == (num_segs - 1));
+
+        uct_ud_neth_set_packet_type(ep, skb->neth, 0, UCT_UD_PACKET_FLAG_PUT);
+        uct_ud_neth_init_data(ep, skb->neth);
+        uct_ud_neth_ack_req(ep, skb->neth);
+        if (is_last) {
+            /* force ACK_REQ because we want to call user completion ASAP */
+            skb->neth->packet_type |= UCT_UD_PACKET_FLAG_ACK_REQ;
+        }
+
+        put_hdr        = (uct_ud_put_hdr_t*)(skb->neth + 1);
+        put_hdr->rva   = remote_addr + offset;
+        skb->len       = sizeof(uct_ud_neth_t) + sizeof(*put_hdr);
+        seg_iov.buffer = UCS_PTR_BYTE_OFFSET(iov->buffer, offset);
+        seg_iov.length = ucs_min(seg_len, length - offset);
+        uct_ud_skb_set_zcopy_desc(skb, &seg_iov, 1, is_last ? comp : NULL);
+
+        zdesc = uct_ud_zcopy_desc(skb);
+        uct_ud_iface_send_ctl(iface, ep, skb, zdesc->iov, zdesc->iovcnt, 0,
+                              UCT_IB_MAX_ZCOPY_LOG_SGE(&iface->super));
+        if (is_last) {
+            uct_ud_iface_complete_tx_skb(iface, ep, skb);
+        } else {
+            uct_ud_ep_add_tx_skb(iface, ep, skb);
+        }
+    }
+
+    UCT_TL_EP_STAT_OP(&ep->super, PUT, ZCOPY, length);
+    uct_ud_leave(iface);
+    return UCS_INPROGRESS;
+
+err_release_skbs:
+    while (seg-- > 0) {
+        ucs_mpool_put(skbs[seg]);
+    }
+err_no_res:
+    uct_ud_leave(iface);
+    return UCS_ERR_NO_RESOURCE;
+}
+
+ucs_status_t uct_ud_ep_get_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
+                                 size_t iovcnt, uint64_t remote_addr,
+                                 uct_rkey_t rkey, uct_completion_t *comp)
+{
+    uct_ud_ep_t *ep       = ucs_derived_of(tl_ep, uct_ud_ep_t);
+    uct_ud_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                           uct_ud_iface_t);
+    uct_ud_send_skb_t *skb, *desc;
+    uct_ud_get_hdr_t *get_hdr;
+    size_t length;
+
+    UCT_CHECK_IOV_SIZE(iovcnt, 1ul, "uct_ud_ep_get_zcopy");
+    length = uct_iov_total_length(iov, iovcnt);
+    UCT_CHECK_LENGTH(length, 0,
+                     uct_ud_iface_rma_seg_len(iface) * UCT_UD_RMA_MAX_SEGS,
+                     "get_zcopy");
+
+    uct_ud_enter(iface);
+
+    skb = uct_ud_ep_get_tx_skb(iface, ep);
+    if (skb == NULL) {
+        goto err_no_res;
+    }
+
+    /* the descriptor tracks the response data until the get is completed */
+    desc = ucs_mpool_get(&iface->tx.mp);
+    if (desc == NULL) {
+        UCT_TL_IFACE_STAT_TX_NO_DESC(&iface->super.super);
+        goto err_no_res;
+    }
+
+    uct_ud_neth_set_packet_type(ep, skb->neth, 0, UCT_UD_PACKET_FLAG_GET);
+    uct_ud_neth_init_data(ep, skb->neth);
+    uct_ud_neth_ack_req(ep, skb->neth);
+
+    get_hdr         = (uct_ud_get_hdr_t*)(skb->neth + 1);
+    get_hdr->rva    = remote_addr;
+    get_hdr->lva    = (uintptr_t)iov->buffer;
+    get_hdr->length = length;
+    skb->len        = sizeof(uct_ud_neth_t) + sizeof(*get_hdr);
+    uct_ud_iface_send_ctl(iface, ep, skb, NULL, 0, 0, 1);
+
+    desc->flags = 0;
+    desc->len   = skb->len;
+    memcpy(desc->neth, skb->neth, skb->len);
+    if (comp != NULL) {
+        desc->flags                 |= UCT_UD_SEND_SKB_FLAG_COMP;
+        uct_ud_comp_desc(desc)->comp = comp;
+    }
+    ucs_queue_push(&ep->tx.get_q, &desc->queue);
+
+    uct_ud_iface_complete_tx_skb(iface, ep, skb);
+    UCT_TL_EP_STAT_OP(&ep->super, GET, ZCOPY, length);
+    uct_ud_leave(iface);
+    return UCS_INPROGRESS;
+
+err_no_res:
+    uct_ud_leave(iface);
+    return UCS_ERR_NO_RESOURCE;
+}
+
 static uct_ud_send_skb_t *uct_ud_ep_prepare_crep(uct_ud_ep_t *ep)
 {
     uct_ud_send_skb_t *skb;
@@ -1347,6 +1855,12 @@ static void uct_ud_ep_resend(uct_ud_ep_t *ep)
     sent_skb = ucs_queue_iter_elem(sent_skb, resend_pos, queue);
 
     ucs_assert(((uintptr_t)sent_skb % UCT_UD_SKB_ALIGN) == 0);
+    if (UCT_UD_PSN_COMPARE(sent_skb->neth->psn, >, ep->resend.max_psn)) {
+        /* resend window was shrunk by fast resend */
+        uct_ud_ep_resend_end(ep);
+        return;
+    }
+
     if (UCT_UD_PSN_COMPARE(sent_skb->neth->psn, >=, ep->tx.max_psn)) {
         ucs_debug("ep(%p): out of window(psn=%d/max_psn=%d) - can not resend more",
                   ep, sent_skb ? sent_skb->neth->psn : -1, ep->tx.max_psn);
@@ -1371,6 +1885,13 @@ static void uct_ud_ep_resend(uct_ud_ep_t *ep)
         return;
     }
 
+    /* skip skb which was selectively acknowledged by the peer */
+    if (sent_skb->flags & UCT_UD_SEND_SKB_FLAG_SACKED) {
+        ucs_trace_data("ep(%p): skb %p psn %u was sacked", ep, sent_skb,
+                       sent_skb->neth->psn);
+        return;
+    }
+
     /* skip dummy skb created for non-blocking flush */
     if ((uct_ud_neth_get_dest_id(sent_skb->neth) == UCT_UD_EP_NULL_ID) &&
         !(sent_skb->neth->packet_type & UCT_UD_PACKET_FLAG_CTL)) {
@@ -1460,10 +1981,30 @@ static void uct_ud_ep_resend(uct_ud_ep_t *ep)
     ++ep->tx.resend_count;
 }
 
+static uint64_t uct_ud_ep_rx_sack_bitmap(uct_ud_ep_t *ep)
+{
+    uct_ud_psn_t base_psn = ucs_frag_list_sn(&ep->rx.ooo_pkts) + 2;
+    uint64_t bitmap       = 0;
+    ucs_frag_list_elem_t *h;
+    uct_ud_psn_t psn;
+
+    /* every list on the frag list is a continuous range of received psns */
+    ucs_queue_for_each(h, &ep->rx.ooo_pkts.list, list) {
+        for (psn = h->head.first_sn;
+             UCT_UD_PSN_COMPARE(psn, <=, h->head.last_sn); ++psn) {
+            ucs_assert((uct_ud_psn_t)(psn - base_psn) < UCT_UD_SACK_BITS);
+            bitmap |= UCS_BIT((uct_ud_psn_t)(psn - base_psn));
+        }
+    }
+
+    return bitmap;
+}
+
 static void uct_ud_ep_send_ack(uct_ud_iface_t *iface, uct_ud_ep_t *ep)
 {
     int ctl_flags        = 0;
     uint32_t packet_type = ep->dest_ep_id;
+    size_t len           = sizeof(uct_ud_neth_t);
     uct_ud_ctl_desc_t *cdesc;
     uct_ud_send_skb_t *skb;
 
@@ -1484,11 +2025,14 @@ static void uct_ud_ep_send_ack(uct_ud_iface_t *iface, uct_ud_ep_t *ep)
 
     if (uct_ud_ep_ctl_op_check(ep, UCT_UD_EP_OP_NACK)) {
         packet_type |= UCT_UD_PACKET_FLAG_NACK;
+        if (!ucs_frag_list_empty(&ep->rx.ooo_pkts)) {
+            len += sizeof(uct_ud_sack_hdr_t);
+        }
     }
 
-    if ((sizeof(uct_ud_neth_t) <= iface->config.max_inline) &&
+    if ((len <= iface->config.max_inline) &&
         !(ctl_flags & UCT_UD_IFACE_SEND_CTL_FLAG_SIGNALED)) {
-        skb        = ucs_alloca(sizeof(*skb) + sizeof(uct_ud_neth_t));
+        skb        = ucs_alloca(sizeof(*skb) + len);
         skb->flags = 0;
 #if UCS_ENABLE_ASSERT
         skb->lkey  = 0;
@@ -1500,9 +2044,14 @@ static void uct_ud_ep_send_ack(uct_ud_iface_t *iface, uct_ud_ep_t *ep)
 
     uct_ud_neth_init_data(ep, skb->neth);
     skb->flags             = UCT_UD_SEND_SKB_FLAG_CTL_ACK;
-    skb->len               = sizeof(uct_ud_neth_t);
+    skb->len               = len;
     skb->neth->packet_type = packet_type;
 
+    if (len > sizeof(uct_ud_neth_t)) {
+        ((uct_ud_sack_hdr_t*)(skb->neth + 1))->bitmap =
+                uct_ud_ep_rx_sack_bitmap(ep);
+    }
+
     if (ctl_flags & UCT_UD_IFACE_SEND_CTL_FLAG_INLINE) {
         uct_ud_iface_send_ctl(iface, ep, skb, NULL, 0, ctl_flags, 1);
     } else {
@@ -1520,6 +2069,61 @@ out:
     uct_ud_ep_ctl_op_del(ep, UCT_UD_EP_OP_CTL_ACK);
 }
 
+static void uct_ud_ep_send_get_resp(uct_ud_iface_t *iface, uct_ud_ep_t *ep)
+{
+    size_t seg_len = uct_ud_iface_rma_seg_len(iface);
+    uct_ud_recv_skb_t *req_skb;
+    uct_ud_get_hdr_t *get_hdr;
+    uct_ud_put_hdr_t *put_hdr;
+    uct_ud_send_skb_t *skb;
+    size_t length;
+    void *hdr;
+
+    while (!ucs_queue_is_empty(&ep->tx.get_resp_q)) {
+        /* the response data is sent on the window, like user puts */
+        if (uct_ud_ep_no_window(ep)) {
+            return;
+        }
+
+        skb = uct_ud_iface_get_tx_skb(iface, ep);
+        if (skb == NULL) {
+            return;
+        }
+
+        req_skb = ucs_queue_head_elem_non_empty(&ep->tx.get_resp_q,
+                                                uct_ud_recv_skb_t, u.am.queue);
+        hdr     = uct_ib_iface_recv_desc_hdr(&iface->super,
+                                             (uct_ib_iface_recv_desc_t*)req_skb);
+        get_hdr = (uct_ud_get_hdr_t*)UCS_PTR_BYTE_OFFSET(hdr, UCT_UD_RX_HDR_LEN);
+        length  = ucs_min(get_hdr->length, seg_len);
+
+        uct_ud_neth_set_packet_type(ep, skb->neth, 0, UCT_UD_PACKET_FLAG_PUT |
+                                                      UCT_UD_PACKET_FLAG_GET);
+        uct_ud_neth_init_data(ep, skb->neth);
+        uct_ud_neth_ack_req(ep, skb->neth);
+
+        put_hdr      = (uct_ud_put_hdr_t*)(skb->neth + 1);
+        put_hdr->rva = get_hdr->lva;
+        memcpy(put_hdr + 1, (void*)get_hdr->rva, length);
+        skb->len     = sizeof(uct_ud_neth_t) + sizeof(*put_hdr) + length;
+
+        get_hdr->rva    += length;
+        get_hdr->lva    += length;
+        get_hdr->length -= length;
+        if (get_hdr->length == 0) {
+            /* release the window on the last packet of the response */
+            skb->neth->packet_type |= UCT_UD_PACKET_FLAG_ACK_REQ;
+            ucs_queue_pull_non_empty(&ep->tx.get_resp_q);
+            ucs_mpool_put(req_skb);
+        }
+
+        uct_ud_iface_send_ctl(iface, ep, skb, NULL, 0, 0, 1);
+        uct_ud_iface_complete_tx_skb(iface, ep, skb);
+    }
+
+    uct_ud_ep_ctl_op_del(ep, UCT_UD_EP_OP_GET_RESP);
+}
+
 static void uct_ud_ep_do_pending_ctl(uct_ud_ep_t *ep, uct_ud_iface_t *iface)
 {
     uct_ud_send_skb_t *skb;
@@ -1542,6 +2146,8 @@ static void uct_ud_ep_do_pending_ctl(uct_ud_ep_t *ep, uct_ud_iface_t *iface)
         uct_ud_ep_resend(ep);
     } else if (uct_ud_ep_ctl_op_check(ep, UCT_UD_EP_OP_CTL_ACK)) {
         uct_ud_ep_send_ack(iface, ep);
+    } else if (uct_ud_ep_ctl_op_check(ep, UCT_UD_EP_OP_GET_RESP)) {
+        uct_ud_ep_send_get_resp(iface, ep);
     } else {
         ucs_assertv(!uct_ud_ep_ctl_op_isany(ep),
                     "unsupported pending op mask: %x", ep->tx.pending.ops);
@@ -1610,11 +2216,18 @@ uct_ud_ep_do_pending(ucs_arbiter_t *arbiter, ucs_arbiter_group_t *group,
         return UCS_ARBITER_CB_RESULT_STOP;
     }
 
+    /* paced endpoint stays scheduled until its window is reopened */
+    if (ucs_unlikely(ep->flags & UCT_UD_EP_FLAG_TX_PACED) &&
+        !uct_ud_ep_cc_open_window(ep, ucs_get_time()) &&
+        !uct_ud_ep_ctl_op_check(ep, UCT_UD_EP_OP_CTL_NO_WINDOW)) {
+        return UCS_ARBITER_CB_RESULT_RESCHED_GROUP;
+    }
+
     /* we can desched group: iff
-     * - no control
+     * - no control, except for control which needs the window
      * - no ep resources (connect or window)
      */
-    if (!uct_ud_ep_ctl_op_isany(ep) &&
+    if (!uct_ud_ep_ctl_op_check(ep, UCT_UD_EP_OP_CTL_NO_WINDOW) &&
         (!uct_ud_ep_is_connected(ep) ||
          uct_ud_ep_no_window(ep))) {
         return UCS_ARBITER_CB_RESULT_DESCHED_GROUP;
@@ -1719,7 +2332,8 @@ ucs_status_t uct_ud_ep_pending_add(uct_ep_h ep_h, uct_pending_req_t *req,
     if (uct_ud_iface_can_tx(iface) &&
         uct_ud_iface_has_skbs(iface) &&
         uct_ud_ep_is_connected_and_no_pending(ep) &&
-        !uct_ud_ep_no_window(ep)) {
+        !uct_ud_ep_no_window(ep) &&
+        ucs_queue_is_empty(&ep->tx.get_q)) {
 
         uct_ud_leave(iface);
         return UCS_ERR_BUSY;
@@ -1890,6 +2504,9 @@ void uct_ud_ep_vfs_populate(uct_ud_ep_t *ep)
                             UCS_VFS_TYPE_U16, "ca/wmax");
     ucs_vfs_obj_add_ro_file(ep, ucs_vfs_show_primitive, &ep->ca.cwnd,
                             UCS_VFS_TYPE_U16, "ca/cwnd");
+    if (ep->flags & UCT_UD_EP_FLAG_CC) {
+        uct_ud_cc_vfs_populate(&ep->cc, ep);
+    }
 
     ucs_vfs_obj_add_ro_file(ep, ucs_vfs_show_primitive, &ep->resend.psn,
                             UCS_VFS_TYPE_U16, "resend/psn");
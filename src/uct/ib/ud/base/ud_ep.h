@@ -8,9 +8,11 @@
 #define UCT_UD_EP_H
 
 #include "ud_def.h"
+#include "ud_cc.h"
 
 #include <uct/api/uct.h>
 #include <ucs/datastruct/frag_list.h>
+#include <ucs/datastruct/list.h>
 #include <ucs/datastruct/queue.h>
 #include <ucs/datastruct/arbiter.h>
 #include <ucs/datastruct/sglib.h>
@@ -157,6 +159,53 @@ do { \
  * When retransmitting, ack is requested if:
  * psn == acked_psn + 1 or
  * psn % UCT_UD_RESENDS_PER_ACK = 0
+ *
+ * Selective acknowledgements (UCX_UD_SACK)
+ *
+ * The receiver keeps out-of-order packets up to UCT_UD_SACK_BITS psns
+ * ahead of the first missing one in rx.ooo_pkts, and replies to them with
+ * a NACK carrying a bitmap of the packets it holds. The sender marks those
+ * packets as SACKED so they are skipped by the resend operation.
+ *
+ * Fast resend: after UCT_UD_CA_DUP_ACK_CNT NACKs for the same acked_psn, or
+ * once as many packets beyond the hole were SACKed, the sender drops the
+ * congestion window and starts a resend immediately instead of waiting for
+ * the slow timer. The resend window ends at the highest SACKed psn, so only
+ * the holes are retransmitted. Only one fast resend is done per acked_psn.
+ *
+ * Pluggable congestion control (UCX_UD_CC)
+ *
+ * With a congestion control algorithm other than the builtin one, the window
+ * above follows the algorithm's window (ca.cwnd = cc window + 1, since the
+ * send window is [acked_psn+1, max_psn)). RTT is sampled on one ACK_REQ
+ * packet at a time and the sample is discarded on resend. When the window
+ * drops below one packet, each send closes the window (TX_PACED) and keeps
+ * the endpoint scheduled on the arbiter, and the pending dispatch reopens it
+ * once the pacing interval elapses.
+ *
+ * Delayed acknowledgements (UCX_UD_ACK_DELAY)
+ *
+ * When enabled, an ACK_REQ carried by a data packet does not schedule a
+ * standalone ACK. Instead the endpoint is added to the interface list of
+ * delayed acks, expecting the ack to be piggybacked on reverse data. The
+ * standalone ACK is sent once UCX_UD_ACK_COALESCE packets are unacknowledged,
+ * or once the delay expires and nothing was sent to the peer meanwhile. The
+ * list is ordered by deadline, and all expired endpoints are scheduled in one
+ * progress pass so their ACKs are sent by a single arbiter dispatch.
+ * ACK_REQ in control packets (flush, resend timer) is always acked at once.
+ *
+ * Zero-copy RMA (UCX_UD_RMA)
+ *
+ * put_zcopy is split into up to UCT_UD_RMA_MAX_SEGS put packets which refer
+ * to the user buffer, like am_zcopy, and are posted at once. Only the first
+ * packet must fit the window, so a put always makes progress even with the
+ * minimal window. The last packet requests an ack and completes the put.
+ * get_zcopy sends one get request packet and keeps a descriptor in
+ * tx.get_q. The target queues the received request in tx.get_resp_q and
+ * replies with put packets from the GET_RESP control operation, which needs
+ * the send window, so the responses are reliable and ordered like any other
+ * data. A get completes when all of its data has arrived; until then the
+ * endpoint flush returns UCS_ERR_NO_RESOURCE.
  */
 
 /*
@@ -172,11 +221,14 @@ enum {
     UCT_UD_EP_OP_CREP       = UCS_BIT(3),  /* send connection reply */
     UCT_UD_EP_OP_CREQ       = UCS_BIT(4),  /* send connection request */
     UCT_UD_EP_OP_NACK       = UCS_BIT(5),  /* send NACK */
+    UCT_UD_EP_OP_GET_RESP   = UCS_BIT(6),  /* send get response data */
 };
 
 #define UCT_UD_EP_OP_CTL_LOW_PRIO (UCT_UD_EP_OP_ACK_REQ|UCT_UD_EP_OP_ACK)
 #define UCT_UD_EP_OP_CTL_HI_PRIO  (UCT_UD_EP_OP_CREQ|UCT_UD_EP_OP_CREP|UCT_UD_EP_OP_RESEND)
 #define UCT_UD_EP_OP_CTL_ACK      (UCT_UD_EP_OP_ACK|UCT_UD_EP_OP_ACK_REQ|UCT_UD_EP_OP_NACK)
+/* control ops which can be sent without the send window */
+#define UCT_UD_EP_OP_CTL_NO_WINDOW (UCT_UD_EP_OP_CTL_HI_PRIO|UCT_UD_EP_OP_CTL_ACK)
 
 typedef struct uct_ud_ep_pending_op {
     ucs_arbiter_group_t   group;
@@ -207,10 +259,16 @@ enum {
                                                        connection establishment process
                                                        is driven by remote side. */
     UCT_UD_EP_FLAG_TX_NACKED         = UCS_BIT(11), /* Last psn was acked with NACK */
+    UCT_UD_EP_FLAG_TX_FAST_RESEND    = UCS_BIT(12), /* Fast resend was started for
+                                                       the current acked_psn */
+    UCT_UD_EP_FLAG_CC                = UCS_BIT(14), /* Window is driven by a
+                                                       congestion control algorithm */
+    UCT_UD_EP_FLAG_TX_PACED          = UCS_BIT(15), /* Window is held closed by
+                                                       pacing */
 
     /* Endpoint is currently executing the pending queue */
 #if UCS_ENABLE_ASSERT
-    UCT_UD_EP_FLAG_IN_PENDING        = UCS_BIT(12)
+    UCT_UD_EP_FLAG_IN_PENDING        = UCS_BIT(13)
 #else
     UCT_UD_EP_FLAG_IN_PENDING        = 0
 #endif
@@ -230,11 +288,16 @@ struct uct_ud_ep {
         uct_ud_psn_t           max_psn;      /* Largest PSN that can be sent */
         uct_ud_psn_t           acked_psn;    /* last psn that was acked by remote side */
         uint16_t               resend_count; /* number of in-flight resends on the ep */
+        uint8_t                dup_acks;     /* NACKs received for acked_psn */
         ucs_queue_head_t       window;       /* send window: [acked_psn+1, psn-1] */
         uct_ud_ep_pending_op_t pending;      /* pending ops */
         ucs_time_t             send_time;    /* tx time of last packet */
         ucs_time_t             resend_time;  /* tx time of last resent packet */
         ucs_time_t             tick;         /* timeout to trigger timer */
+        ucs_time_t             rtt_time;     /* tx time of RTT probe, 0 if none */
+        uct_ud_psn_t           rtt_psn;      /* psn of RTT probe */
+        ucs_queue_head_t       get_q;        /* outstanding get operations */
+        ucs_queue_head_t       get_resp_q;   /* received get requests to reply */
         UCS_STATS_NODE_DECLARE(stats)
         UCT_UD_EP_HOOK_DECLARE(tx_hook)
     } tx;
@@ -242,6 +305,8 @@ struct uct_ud_ep {
         uct_ud_psn_t        acked_psn;    /* Last psn we acked */
         ucs_frag_list_t     ooo_pkts;     /* Out of order packets that can not be processed yet,
                                             also keeps last psn we successfully received and processed */
+        ucs_time_t          ack_time;     /* Deadline of the delayed ack, 0 if none */
+        ucs_list_link_t     ack_list;     /* Entry in iface delayed acks list */
         UCS_STATS_NODE_DECLARE(stats)
         UCT_UD_EP_HOOK_DECLARE(rx_hook)
     } rx;
@@ -249,6 +314,7 @@ struct uct_ud_ep {
         uct_ud_psn_t  wmax;
         uct_ud_psn_t  cwnd;
     } ca;
+    uct_ud_cc_t           cc;           /* congestion control, if UCT_UD_EP_FLAG_CC */
     struct UCS_S_PACKED {
          ucs_queue_iter_t       pos;       /* points to the part of tx window that needs to be resent */
          uct_ud_psn_t           psn;       /* last psn that was retransmitted */
@@ -306,6 +372,14 @@ ucs_status_t uct_ud_ep_flush_nolock(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
 
 ucs_status_t uct_ud_ep_check(uct_ep_h tl_ep, unsigned flags, uct_completion_t *comp);
 
+ucs_status_t uct_ud_ep_put_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
+                                 size_t iovcnt, uint64_t remote_addr,
+                                 uct_rkey_t rkey, uct_completion_t *comp);
+
+ucs_status_t uct_ud_ep_get_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
+                                 size_t iovcnt, uint64_t remote_addr,
+                                 uct_rkey_t rkey, uct_completion_t *comp);
+
 ucs_status_t uct_ud_ep_get_address(uct_ep_h tl_ep, uct_ep_addr_t *addr);
 
 ucs_status_t uct_ud_ep_create(const uct_ep_params_t *params, uct_ep_h *ep_p);
@@ -337,6 +411,9 @@ uct_ud_ep_do_pending(ucs_arbiter_t *arbiter, ucs_arbiter_group_t *group,
 
 void uct_ud_ep_vfs_populate(uct_ud_ep_t *ep);
 
+void uct_ud_ep_cc_sent(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                       uct_ud_send_skb_t *skb, ucs_time_t now);
+
 int uct_ud_ep_is_same_dest_ep(const uct_ud_ep_t *ep,
                               const uct_ep_is_connected_params_t *params);
 
@@ -353,6 +430,21 @@ void uct_ud_ep_process_rx(uct_ud_iface_t *iface,
                           uct_ud_recv_skb_t *skb, int is_async);
 
 
+static UCS_F_ALWAYS_INLINE int uct_ud_ep_rx_is_acked(uct_ud_ep_t *ep)
+{
+    return ep->rx.acked_psn == ucs_frag_list_sn(&ep->rx.ooo_pkts);
+}
+
+
+static UCS_F_ALWAYS_INLINE void uct_ud_ep_ack_delay_cancel(uct_ud_ep_t *ep)
+{
+    if (ep->rx.ack_time != 0) {
+        ucs_list_del(&ep->rx.ack_list);
+        ep->rx.ack_time = 0;
+    }
+}
+
+
 static UCS_F_ALWAYS_INLINE void
 uct_ud_neth_init_data(uct_ud_ep_t *ep, uct_ud_neth_t *neth)
 {
@@ -480,9 +480,35 @@ UCS_CLASS_INIT_FUNC(uct_ud_iface_t, uct_ud_iface_ops_t *ops,
         return UCS_ERR_INVALID_PARAM;
     }
 
-    self->config.max_window = config->max_window;
+    self->config.max_window       = config->max_window;
+    self->config.sack             = config->sack;
+    self->config.rx_drop_interval = config->rx_drop_interval;
+
+    if (config->ack_delay >= config->timer_tick) {
+        ucs_error("UD ack delay (%.2fus) must be smaller than the timer tick "
+                  "(%.2fus)", config->ack_delay * UCS_USEC_PER_SEC,
+                  config->timer_tick * UCS_USEC_PER_SEC);
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    if (config->ack_coalesce == 0) {
+        ucs_error("UD ack coalescing threshold must be > 0");
+        return UCS_ERR_INVALID_PARAM;
+    }
+
+    self->config.ack_delay        = ucs_time_from_sec(config->ack_delay);
+    self->config.ack_coalesce     = config->ack_coalesce;
+    self->config.rma              = config->rma;
+
+    /* The send window is one psn larger than the number of packets in flight */
+    status = uct_ud_cc_params_init(&self->config.cc, &config->cc,
+                                   config->max_window - 1);
+    if (status != UCS_OK) {
+        return status;
+    }
 
     self->rx.async_max_poll = config->rx_async_max_poll;
+    self->rx.drop_count     = 0;
 
     if (config->timer_tick <= 0.) {
         ucs_error("The timer tick should be > 0 (%lf)",
@@ -570,6 +596,7 @@ UCS_CLASS_INIT_FUNC(uct_ud_iface_t, uct_ud_iface_ops_t *ops,
 
     ucs_queue_head_init(&self->tx.async_comp_q);
     ucs_queue_head_init(&self->rx.pending_q);
+    ucs_list_head_init(&self->rx.ack_list);
 
     status = UCS_STATS_NODE_ALLOC(&self->stats, &uct_ud_iface_stats_class,
                                   self->super.stats, "-%p", self);
@@ -698,6 +725,36 @@ ucs_config_field_t uct_ud_iface_config_table[] = {
      "Max number of receive completions to pick during asynchronous TX poll",
      ucs_offsetof(uct_ud_iface_config_t, rx_async_max_poll), UCS_CONFIG_TYPE_UINT},
 
+    {"SACK", "y",
+     "Keep out-of-order packets on the receiver and acknowledge them selectively,\n"
+     "so the sender retransmits only the missing packets.",
+     ucs_offsetof(uct_ud_iface_config_t, sack), UCS_CONFIG_TYPE_BOOL},
+
+    {"ACK_DELAY", "0",
+     "Maximal time to hold an acknowledgment requested by the peer, so it can be\n"
+     "piggybacked on reverse data instead of being sent as a separate packet.\n"
+     "Must be smaller than UCX_UD_TIMER_TICK. 0 acknowledges immediately.",
+     ucs_offsetof(uct_ud_iface_config_t, ack_delay), UCS_CONFIG_TYPE_TIME},
+
+    {"ACK_COALESCE", "32",
+     "Send a delayed acknowledgment as soon as this number of received packets\n"
+     "is not acknowledged. Used only when UCX_UD_ACK_DELAY is not 0.",
+     ucs_offsetof(uct_ud_iface_config_t, ack_coalesce), UCS_CONFIG_TYPE_UINT},
+
+    {"RMA", "n",
+     "Enable put and get zero-copy operations. The data is segmented to datagrams\n"
+     "on the send window and copied to the remote address by the receiver.",
+     ucs_offsetof(uct_ud_iface_config_t, rma), UCS_CONFIG_TYPE_BOOL},
+
+    {"RX_DROP_INTERVAL", "0",
+     "Drop every N-th received data packet, to test the reliability protocol.\n"
+     "0 disables packet drop.",
+     ucs_offsetof(uct_ud_iface_config_t, rx_drop_interval), UCS_CONFIG_TYPE_UINT},
+
+    {"", "", NULL,
+     ucs_offsetof(uct_ud_iface_config_t, cc),
+     UCS_CONFIG_TYPE_TABLE(uct_ud_cc_config_table)},
+
     {NULL}
 };
 
@@ -746,6 +803,23 @@ ucs_status_t uct_ud_iface_query(uct_ud_iface_t *iface,
                                                                sizeof(uct_ud_neth_t) +
                                                                sizeof(uct_ud_put_hdr_t));
 
+    if (iface->config.rma) {
+        iface_attr->cap.flags         |= UCT_IFACE_FLAG_PUT_ZCOPY |
+                                         UCT_IFACE_FLAG_GET_ZCOPY;
+
+        iface_attr->cap.put.min_zcopy       = 0;
+        iface_attr->cap.put.max_zcopy       = uct_ud_iface_rma_seg_len(iface) *
+                                              UCT_UD_RMA_MAX_SEGS;
+        iface_attr->cap.put.opt_zcopy_align = UCS_SYS_PCI_MAX_PAYLOAD;
+        iface_attr->cap.put.align_mtu       = iface_attr->cap.am.align_mtu;
+        iface_attr->cap.put.max_iov         = 1;
+        iface_attr->cap.get.min_zcopy       = 0;
+        iface_attr->cap.get.max_zcopy       = iface_attr->cap.put.max_zcopy;
+        iface_attr->cap.get.opt_zcopy_align = UCS_SYS_PCI_MAX_PAYLOAD;
+        iface_attr->cap.get.align_mtu       = iface_attr->cap.am.align_mtu;
+        iface_attr->cap.get.max_iov         = 1;
+    }
+
     iface_attr->iface_addr_len         = sizeof(uct_ud_iface_addr_t);
     iface_attr->ep_addr_len            = sizeof(uct_ud_ep_addr_t);
     iface_attr->max_conn_priv          = 0;
@@ -907,6 +981,28 @@ unsigned uct_ud_iface_dispatch_pending_rx_do(uct_ud_iface_t *iface)
     return count;
 }
 
+void uct_ud_iface_ack_progress(uct_ud_iface_t *iface)
+{
+    ucs_time_t now = ucs_get_time();
+    uct_ud_ep_t *ep;
+
+    /* The list is ordered by deadline, since the delay is the same for all
+     * endpoints. Schedule all expired acks, so they are sent by the following
+     * pending dispatch. Acks which were piggybacked on data are dropped. */
+    do {
+        ep = ucs_list_head(&iface->rx.ack_list, uct_ud_ep_t, rx.ack_list);
+        if (!uct_ud_ep_rx_is_acked(ep)) {
+            if ((int64_t)(ep->rx.ack_time - now) > 0) {
+                break;
+            }
+
+            uct_ud_ep_ctl_op_add(iface, ep, UCT_UD_EP_OP_ACK);
+        }
+
+        uct_ud_ep_ack_delay_cancel(ep);
+    } while (!ucs_list_is_empty(&iface->rx.ack_list));
+}
+
 static void uct_ud_iface_free_pending_rx(uct_ud_iface_t *iface)
 {
     uct_ud_recv_skb_t *skb;
@@ -62,6 +62,12 @@ typedef struct uct_ud_iface_config {
     int                           dgid_check;
     unsigned                      max_window;
     unsigned                      rx_async_max_poll;
+    int                           sack;
+    unsigned                      rx_drop_interval;
+    double                        ack_delay;
+    unsigned                      ack_coalesce;
+    int                           rma;
+    uct_ud_cc_config_t            cc;
 } uct_ud_iface_config_t;
 
 
@@ -166,7 +172,9 @@ struct uct_ud_iface {
         unsigned             available;
         unsigned             quota;
         unsigned             async_max_poll;
+        unsigned             drop_count;
         ucs_queue_head_t     pending_q;
+        ucs_list_link_t      ack_list; /* Endpoints with delayed acks */
         UCT_UD_IFACE_HOOK_DECLARE(hook)
     } rx;
     struct {
@@ -196,6 +204,12 @@ struct uct_ud_iface {
         unsigned             max_inline;
         int                  check_grh_dgid;
         unsigned             max_window;
+        int                  sack;
+        unsigned             rx_drop_interval;
+        ucs_time_t           ack_delay;
+        unsigned             ack_coalesce;
+        int                  rma;
+        uct_ud_cc_params_t   cc;
     } config;
 
     UCS_STATS_NODE_DECLARE(stats)
@@ -348,6 +362,8 @@ void uct_ud_iface_cep_remove_ep(uct_ud_iface_t *iface, uct_ud_ep_t *ep);
 
 unsigned uct_ud_iface_dispatch_pending_rx_do(uct_ud_iface_t *iface);
 
+void uct_ud_iface_ack_progress(uct_ud_iface_t *iface);
+
 ucs_status_t uct_ud_iface_event_arm_common(uct_ud_iface_t *iface,
                                            unsigned events, uint64_t *dirs_p);
 
@@ -382,6 +398,14 @@ static UCS_F_ALWAYS_INLINE int uct_ud_iface_has_skbs(uct_ud_iface_t *iface)
 }
 
 
+/* data size of a single put/get zero-copy packet */
+static UCS_F_ALWAYS_INLINE size_t uct_ud_iface_rma_seg_len(uct_ud_iface_t *iface)
+{
+    return iface->super.config.seg_size - UCT_UD_RX_HDR_LEN -
+           sizeof(uct_ud_put_hdr_t);
+}
+
+
 static inline uct_ib_address_t* uct_ud_creq_ib_addr(uct_ud_ctl_hdr_t *conn_req)
 {
     ucs_assert(conn_req->type == UCT_UD_PACKET_CREQ);
@@ -464,6 +488,10 @@ uct_ud_iface_progress_pending(uct_ud_iface_t *iface, const uintptr_t is_async)
         iface->tx.async_before_pending = 0;
     }
 
+    if (ucs_unlikely(!ucs_list_is_empty(&iface->rx.ack_list))) {
+        uct_ud_iface_ack_progress(iface);
+    }
+
     if (!uct_ud_iface_can_tx(iface)) {
         return;
     }
@@ -155,15 +155,19 @@ uct_ud_skb_set_zcopy_desc(uct_ud_send_skb_t *skb, const uct_iov_t *iov,
     }
 }
 
+/* add a sent skb to the window, without replacing the cached iface skb */
 static UCS_F_ALWAYS_INLINE void
-uct_ud_iface_complete_tx_skb(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
-                             uct_ud_send_skb_t *skb)
+uct_ud_ep_add_tx_skb(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                     uct_ud_send_skb_t *skb)
 {
     ucs_time_t now = ucs_get_time();
 
-    iface->tx.skb = ucs_mpool_get(&iface->tx.mp);
     ep->tx.psn++;
 
+    if (ucs_unlikely(ep->flags & UCT_UD_EP_FLAG_CC)) {
+        uct_ud_ep_cc_sent(iface, ep, skb, now);
+    }
+
     if (ucs_queue_is_empty(&ep->tx.window)) {
         ep->tx.send_time = now;
     }
@@ -177,6 +181,14 @@ uct_ud_iface_complete_tx_skb(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
     }
 }
 
+static UCS_F_ALWAYS_INLINE void
+uct_ud_iface_complete_tx_skb(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
+                             uct_ud_send_skb_t *skb)
+{
+    iface->tx.skb = ucs_mpool_get(&iface->tx.mp);
+    uct_ud_ep_add_tx_skb(iface, ep, skb);
+}
+
 static UCS_F_ALWAYS_INLINE void
 uct_ud_iface_complete_tx_inl(uct_ud_iface_t *iface, uct_ud_ep_t *ep,
                              uct_ud_send_skb_t *skb, void *data,
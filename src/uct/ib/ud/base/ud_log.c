@@ -17,7 +17,9 @@ void uct_ud_dump_packet(uct_base_iface_t *iface, uct_am_trace_type_t type,
                         char *buffer, size_t max)
 {
     uct_ud_neth_t *neth = data;
+    uct_ud_sack_hdr_t *sackh;
     uct_ud_put_hdr_t *puth;
+    uct_ud_get_hdr_t *geth;
     uct_ud_ctl_hdr_t *ctlh;
     char *p, *endp;
     char buf[128];
@@ -39,11 +41,22 @@ void uct_ud_dump_packet(uct_base_iface_t *iface, uct_am_trace_type_t type,
         uct_iface_dump_am(iface, type, am_id, neth + 1,
                           length - sizeof(*neth), p, endp - p);
     } else if (neth->packet_type & UCT_UD_PACKET_FLAG_NACK) {
-        snprintf(p, endp - p, " NACK");
+        if (length >= (sizeof(*neth) + sizeof(uct_ud_sack_hdr_t))) {
+            sackh = (uct_ud_sack_hdr_t *)(neth + 1);
+            snprintf(p, endp - p, " NACK SACK 0x%"PRIx64, sackh->bitmap);
+        } else {
+            snprintf(p, endp - p, " NACK");
+        }
     } else if (neth->packet_type & UCT_UD_PACKET_FLAG_PUT) {
         puth = (uct_ud_put_hdr_t *)(neth + 1);
-        snprintf(p, endp - p, " PUT: 0x%0lx len %zu", puth->rva,
-                 length - sizeof(*puth) - sizeof(*neth));
+        snprintf(p, endp - p, " %s: 0x%0lx len %zu",
+                 (neth->packet_type & UCT_UD_PACKET_FLAG_GET) ? "GET_RESP" :
+                                                                "PUT",
+                 puth->rva, length - sizeof(*puth) - sizeof(*neth));
+    } else if (neth->packet_type & UCT_UD_PACKET_FLAG_GET) {
+        geth = (uct_ud_get_hdr_t *)(neth + 1);
+        snprintf(p, endp - p, " GET: 0x%0lx to 0x%0lx len %u", geth->rva,
+                 geth->lva, geth->length);
     } else if (neth->packet_type & UCT_UD_PACKET_FLAG_CTL) {
         ctlh = (uct_ud_ctl_hdr_t *)(neth + 1);
         switch (ctlh->type) {
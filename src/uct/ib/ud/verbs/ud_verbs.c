@@ -698,6 +698,8 @@ static uct_iface_ops_t uct_ud_verbs_iface_tl_ops = {
     .ep_am_short_iov          = uct_ud_verbs_ep_am_short_iov,
     .ep_am_bcopy              = uct_ud_verbs_ep_am_bcopy,
     .ep_am_zcopy              = uct_ud_verbs_ep_am_zcopy,
+    .ep_put_zcopy             = uct_ud_ep_put_zcopy,
+    .ep_get_zcopy             = uct_ud_ep_get_zcopy,
     .ep_pending_add           = uct_ud_ep_pending_add,
     .ep_pending_purge         = uct_ud_ep_pending_purge,
     .ep_flush                 = uct_ud_ep_flush,
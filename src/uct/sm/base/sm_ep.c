@@ -9,6 +9,7 @@
 
 #include "sm_ep.h"
 
+#include <uct/base/uct_iov.inl>
 #include <ucs/arch/atomic.h>
 #include <ucs/time/time.h>
 
@@ -59,6 +60,56 @@ ucs_status_t uct_sm_ep_get_bcopy(uct_ep_h tl_ep, uct_unpack_callback_t unpack_cb
     return UCS_OK;
 }
 
+static UCS_F_ALWAYS_INLINE size_t
+uct_sm_ep_iov_copy(const uct_iov_t *iov, size_t iovcnt, void *remote_ptr,
+                   int is_put)
+{
+    size_t length = 0;
+    size_t iov_length;
+    void *ptr;
+    size_t i;
+
+    /* Same address space: every iov element is a single memcpy */
+    for (i = 0; i < iovcnt; ++i) {
+        iov_length = uct_iov_get_length(&iov[i]);
+        ptr        = UCS_PTR_BYTE_OFFSET(remote_ptr, length);
+        if (is_put) {
+            memcpy(ptr, iov[i].buffer, iov_length);
+        } else {
+            memcpy(iov[i].buffer, ptr, iov_length);
+        }
+        length += iov_length;
+    }
+
+    return length;
+}
+
+ucs_status_t uct_sm_ep_put_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
+                                 size_t iovcnt, uint64_t remote_addr,
+                                 uct_rkey_t rkey, uct_completion_t *comp)
+{
+    size_t length;
+
+    length = uct_sm_ep_iov_copy(iov, iovcnt, (void*)(rkey + remote_addr), 1);
+    uct_sm_ep_trace_data(remote_addr, rkey, "PUT_ZCOPY [iovcnt %zu size %zu]",
+                         iovcnt, length);
+    UCT_TL_EP_STAT_OP(ucs_derived_of(tl_ep, uct_base_ep_t), PUT, ZCOPY, length);
+    return UCS_OK;
+}
+
+ucs_status_t uct_sm_ep_get_zcopy(uct_ep_h tl_ep, const uct_iov_t *iov,
+                                 size_t iovcnt, uint64_t remote_addr,
+                                 uct_rkey_t rkey, uct_completion_t *comp)
+{
+    size_t length;
+
+    length = uct_sm_ep_iov_copy(iov, iovcnt, (void*)(rkey + remote_addr), 0);
+    uct_sm_ep_trace_data(remote_addr, rkey, "GET_ZCOPY [iovcnt %zu size %zu]",
+                         iovcnt, length);
+    UCT_TL_EP_STAT_OP(ucs_derived_of(tl_ep, uct_base_ep_t), GET, ZCOPY, length);
+    return UCS_OK;
+}
+
 ucs_status_t uct_sm_ep_atomic32_post(uct_ep_h ep, unsigned opcode, uint32_t value,
                                      uint64_t remote_addr, uct_rkey_t rkey)
 {
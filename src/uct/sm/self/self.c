@@ -80,7 +80,9 @@ static ucs_status_t uct_self_iface_query(uct_iface_h tl_iface, uct_iface_attr_t
                                    UCT_IFACE_FLAG_AM_BCOPY         |
                                    UCT_IFACE_FLAG_PUT_SHORT        |
                                    UCT_IFACE_FLAG_PUT_BCOPY        |
+                                   UCT_IFACE_FLAG_PUT_ZCOPY        |
                                    UCT_IFACE_FLAG_GET_BCOPY        |
+                                   UCT_IFACE_FLAG_GET_ZCOPY        |
                                    UCT_IFACE_FLAG_ATOMIC_CPU       |
                                    UCT_IFACE_FLAG_PENDING          |
                                    UCT_IFACE_FLAG_CB_SYNC          |
@@ -102,17 +104,17 @@ static ucs_status_t uct_self_iface_query(uct_iface_h tl_iface, uct_iface_attr_t
     attr->cap.put.max_short       = UINT_MAX;
     attr->cap.put.max_bcopy       = SIZE_MAX;
     attr->cap.put.min_zcopy       = 0;
-    attr->cap.put.max_zcopy       = 0;
+    attr->cap.put.max_zcopy       = SIZE_MAX;
     attr->cap.put.opt_zcopy_align = 1;
     attr->cap.put.align_mtu       = attr->cap.put.opt_zcopy_align;
-    attr->cap.put.max_iov         = 1;
+    attr->cap.put.max_iov         = UCT_SM_MAX_IOV;
 
     attr->cap.get.max_bcopy       = SIZE_MAX;
     attr->cap.get.min_zcopy       = 0;
-    attr->cap.get.max_zcopy       = 0;
+    attr->cap.get.max_zcopy       = SIZE_MAX;
     attr->cap.get.opt_zcopy_align = 1;
     attr->cap.get.align_mtu       = attr->cap.get.opt_zcopy_align;
-    attr->cap.get.max_iov         = 1;
+    attr->cap.get.max_iov         = UCT_SM_MAX_IOV;
 
     attr->cap.am.max_short        = iface->send_size;
     attr->cap.am.max_bcopy        = iface->send_size;
@@ -395,7 +397,9 @@ static uct_iface_internal_ops_t uct_self_iface_internal_ops = {
 static uct_iface_ops_t uct_self_iface_ops = {
     .ep_put_short             = uct_sm_ep_put_short,
     .ep_put_bcopy             = uct_sm_ep_put_bcopy,
+    .ep_put_zcopy             = uct_sm_ep_put_zcopy,
     .ep_get_bcopy             = uct_sm_ep_get_bcopy,
+    .ep_get_zcopy             = uct_sm_ep_get_zcopy,
     .ep_am_short              = uct_self_ep_am_short,
     .ep_am_short_iov          = uct_self_ep_am_short_iov,
     .ep_am_bcopy              = uct_self_ep_am_bcopy,
@@ -18,6 +18,7 @@
 #include <ucs/algorithm/crc.h>
 #include <ucs/sys/event_set.h>
 #include <ucs/sys/iovec.h>
+#include <ucs/time/time.h>
 
 #include <net/if.h>
 
@@ -36,13 +37,25 @@
 #define UCT_TCP_EP_CTX_CAPS_STR_MAX           8
 
 /* How many IOVs are needed to keep AM/PUT Zcopy service data
- * (TCP protocol and user's AM (or PUT) headers) */
-#define UCT_TCP_EP_ZCOPY_SERVICE_IOV_COUNT    2
+ * (TCP protocol and user's AM (or PUT) headers, checksum) */
+#define UCT_TCP_EP_ZCOPY_SERVICE_IOV_COUNT    3
 
 /* How many IOVs are needed to do AM Short
  * (TCP protocol and user's AM headers, payload) */
 #define UCT_TCP_EP_AM_SHORTV_IOV_COUNT        3
 
+/* AM ID flag which indicates that the AM data is followed by its CRC32C
+ * checksum */
+#define UCT_TCP_AM_ID_FLAG_CHECKSUM           UCS_BIT(7)
+
+/* Length of the checksum which follows AM data */
+#define UCT_TCP_AM_CHECKSUM_LENGTH            sizeof(uint32_t)
+
+/* Length of the service data which is sent along with user's AM payload
+ * (TCP AM header and checksum) */
+#define UCT_TCP_AM_SERVICE_LENGTH             (sizeof(uct_tcp_am_hdr_t) + \
+                                               UCT_TCP_AM_CHECKSUM_LENGTH)
+
 /* Maximum size of a data that can be sent by PUT Zcopy
  * operation */
 #define UCT_TCP_EP_PUT_ZCOPY_MAX              SIZE_MAX
@@ -114,7 +127,9 @@ enum {
     /* EP is on EP PTR map. */
     UCT_TCP_EP_FLAG_ON_PTR_MAP         = UCS_BIT(9),
     /* EP has some operations done without flush */
-    UCT_TCP_EP_FLAG_NEED_FLUSH         = UCS_BIT(10)
+    UCT_TCP_EP_FLAG_NEED_FLUSH         = UCS_BIT(10),
+    /* PUT RX operation payload has to be verified against its checksum. */
+    UCT_TCP_EP_FLAG_PUT_RX_CHECKSUM    = UCS_BIT(11)
 };
 
 
@@ -239,6 +254,17 @@ typedef struct uct_tcp_ep_put_req_hdr {
 } UCS_S_PACKED uct_tcp_ep_put_req_hdr_t;
 
 
+/**
+ * TCP PUT request checksum, follows @ref uct_tcp_ep_put_req_hdr_t when the
+ * PUT request is sent with @ref UCT_TCP_AM_ID_FLAG_CHECKSUM
+ */
+typedef struct uct_tcp_ep_put_req_checksum {
+    uint32_t                      data;        /* Checksum of the PUT payload */
+    uint32_t                      hdr;         /* Checksum of the PUT request header
+                                                * and the payload checksum */
+} UCS_S_PACKED uct_tcp_ep_put_req_checksum_t;
+
+
 /**
  * TCP PUT acknowledge header
  */
@@ -261,6 +287,17 @@ typedef struct uct_tcp_ep_put_completion {
 } uct_tcp_ep_put_completion_t;
 
 
+/**
+ * Token bucket which limits the sending rate
+ */
+typedef struct uct_tcp_pacer {
+    double                        tokens;       /* Number of bytes which may be
+                                                 * sent; negative after a send
+                                                 * which exceeded the balance */
+    ucs_time_t                    last_refill;  /* Time of the last refill */
+} uct_tcp_pacer_t;
+
+
 /**
  * TCP endpoint communication context
  */
@@ -271,6 +308,12 @@ typedef struct uct_tcp_ep_ctx {
     size_t                        length;         /* How much data in the buffer */
     size_t                        offset;         /* How much data was sent (TX) or was
                                                    * handled after receiving (RX) */
+    struct {
+        uint32_t                  expected;       /* Checksum of the PUT payload sent
+                                                   * by the peer */
+        uint32_t                  value;          /* Checksum of the PUT payload
+                                                   * received so far */
+    } put_checksum;
 } uct_tcp_ep_ctx_t;
 
 
@@ -283,6 +326,7 @@ typedef struct uct_tcp_ep_zcopy_tx {
     uct_completion_t              *comp;     /* Local UCT completion object */
     size_t                        iov_index; /* Current IOV index */
     size_t                        iov_cnt;   /* Number of IOVs that should be sent */
+    uint32_t                      checksum;  /* Checksum of the sent data */
     struct iovec                  iov[0];    /* IOVs that should be sent */
 } uct_tcp_ep_zcopy_tx_t;
 
@@ -349,6 +393,7 @@ struct uct_tcp_ep {
     ucs_queue_head_t              pending_q;    /* Pending operations */
     ucs_queue_head_t              put_comp_q;   /* Flush completions waiting for
                                                  * outstanding PUTs acknowledgment */
+    uct_tcp_pacer_t               pacer;        /* Per-endpoint sending rate limit */
     union {
         ucs_list_link_t           list;         /* List element to insert into TCP EP list */
         ucs_conn_match_elem_t     elem;         /* Connection matching element, used by EPs
@@ -383,6 +428,7 @@ typedef struct uct_tcp_iface {
                                                       * waiting for PUT Zcopy operation ACKs
                                                       * (0/1 for each EP) */
     ucs_range_spec_t              port_range;        /** Range of ports to use for bind() */
+    uct_tcp_pacer_t               pacer;             /* Interface sending rate limit */
 
     struct {
         size_t                    tx_seg_size;       /* TX AM buffer size */
@@ -403,6 +449,7 @@ typedef struct uct_tcp_iface {
         ucs_ternary_auto_value_t  ep_bind_src_addr;  /* Bind EP's FD to ifaddr */
         int                       prefer_default;    /* Prefer default gateway */
         int                       put_enable;        /* Enable PUT Zcopy operation support */
+        int                       checksum;          /* Protect sent data by CRC32C */
         int                       conn_nb;           /* Use non-blocking connect() */
         unsigned                  max_poll;          /* Number of events to poll per socket*/
         uint8_t                   max_conn_retries;  /* How many connection establishment attempts
@@ -412,6 +459,15 @@ typedef struct uct_tcp_iface {
                                                       * before aborting the attempt to connect.
                                                       * It cannot exceed 255. */
         double                    max_bw;            /* Upper bound to TCP iface bandwidth */
+        struct {
+            int                   enable;            /* Whether the sending rate is limited */
+            double                iface_rate;        /* Interface rate in bytes per second,
+                                                      * 0 if not limited */
+            double                ep_rate;           /* Endpoint rate in bytes per second,
+                                                      * 0 if not limited */
+            double                burst;             /* Maximal number of bytes sent at once
+                                                      * after an idle period */
+        } pacing;
         struct {
             ucs_time_t            idle;              /* The time the connection needs to remain
                                                       * idle before TCP starts sending keepalive
@@ -443,6 +499,7 @@ typedef struct uct_tcp_iface_config {
     size_t                         sendv_thresh;
     int                            prefer_default;
     int                            put_enable;
+    int                            checksum;
     int                            conn_nb;
     unsigned                       max_poll;
     unsigned                       max_conn_retries;
@@ -453,6 +510,11 @@ typedef struct uct_tcp_iface_config {
     uct_iface_mpool_config_t       rx_mpool;
     ucs_range_spec_t               port_range;
     double                         max_bw;
+    struct {
+        double                     iface_rate;
+        double                     ep_rate;
+        size_t                     burst;
+    } pacing;
     struct {
         ucs_time_t                 idle;
         unsigned long              cnt;
@@ -661,6 +723,32 @@ static UCS_F_ALWAYS_INLINE int uct_tcp_ep_ctx_buf_empty(uct_tcp_ep_ctx_t *ctx)
     return ctx->length == 0;
 }
 
+static UCS_F_ALWAYS_INLINE void
+uct_tcp_pacer_init(uct_tcp_pacer_t *pacer, double burst)
+{
+    pacer->tokens      = burst;
+    pacer->last_refill = ucs_get_time();
+}
+
+/**
+ * Add the tokens accumulated since the last refill, bounded by the burst size.
+ *
+ * @return Nonzero if sending is allowed.
+ */
+static UCS_F_ALWAYS_INLINE int
+uct_tcp_pacer_refill(uct_tcp_pacer_t *pacer, double rate, double burst,
+                     ucs_time_t now)
+{
+    if (pacer->tokens < burst) {
+        pacer->tokens = ucs_min(burst, pacer->tokens +
+                                       (rate * ucs_time_to_sec(
+                                                now - pacer->last_refill)));
+    }
+
+    pacer->last_refill = now;
+    return pacer->tokens > 0;
+}
+
 static inline void uct_tcp_iface_outstanding_inc(uct_tcp_iface_t *iface)
 {
     iface->outstanding++;
@@ -11,6 +11,7 @@
 #include "tcp.h"
 #include "tcp/tcp.h"
 
+#include <ucs/algorithm/crc.h>
 #include <ucs/async/async.h>
 
 
@@ -61,11 +62,62 @@ static inline int uct_tcp_ep_ctx_buf_need_progress(uct_tcp_ep_ctx_t *ctx)
     return ctx->offset < ctx->length;
 }
 
+static UCS_F_NOINLINE int uct_tcp_ep_pacing_check(uct_tcp_iface_t *iface,
+                                                  uct_tcp_ep_t *ep)
+{
+    ucs_time_t now = ucs_get_time();
+    int allowed    = 1;
+
+    if (iface->config.pacing.iface_rate > 0) {
+        allowed = uct_tcp_pacer_refill(&iface->pacer,
+                                       iface->config.pacing.iface_rate,
+                                       iface->config.pacing.burst, now);
+    }
+
+    if (iface->config.pacing.ep_rate > 0) {
+        allowed = uct_tcp_pacer_refill(&ep->pacer,
+                                       iface->config.pacing.ep_rate,
+                                       iface->config.pacing.burst, now) &&
+                  allowed;
+    }
+
+    return allowed;
+}
+
+/* Whether the sending rate limits allow to send more data */
+static UCS_F_ALWAYS_INLINE int uct_tcp_ep_pacing_allowed(uct_tcp_ep_t *ep)
+{
+    uct_tcp_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                            uct_tcp_iface_t);
+
+    return ucs_likely(!iface->config.pacing.enable) ||
+           uct_tcp_ep_pacing_check(iface, ep);
+}
+
+static UCS_F_ALWAYS_INLINE void
+uct_tcp_ep_pacing_consume(uct_tcp_ep_t *ep, size_t sent_length)
+{
+    uct_tcp_iface_t *iface = ucs_derived_of(ep->super.super.iface,
+                                            uct_tcp_iface_t);
+
+    if (ucs_unlikely(iface->config.pacing.enable)) {
+        iface->pacer.tokens -= sent_length;
+        ep->pacer.tokens    -= sent_length;
+    }
+}
+
 static inline ucs_status_t uct_tcp_ep_check_tx_res(uct_tcp_ep_t *ep)
 {
     if (ucs_likely((ep->conn_state == UCT_TCP_EP_CONN_STATE_CONNECTED) &&
                    uct_tcp_ep_ctx_buf_empty(&ep->tx))) {
-        return UCS_OK;
+        if (ucs_likely(uct_tcp_ep_pacing_allowed(ep))) {
+            return UCS_OK;
+        }
+
+        /* Sending rate limit is exceeded: poll the socket for writing to
+         * retry pending operations after the tokens are refilled */
+        uct_tcp_ep_mod_events(ep, UCS_EVENT_SET_EVWRITE, 0);
+        return UCS_ERR_NO_RESOURCE;
     } else if (ucs_unlikely(ep->conn_state == UCT_TCP_EP_CONN_STATE_CLOSED)) {
         return UCS_ERR_CONNECTION_RESET;
     } else if (ucs_unlikely(ep->conn_state ==
@@ -241,6 +293,7 @@ static UCS_CLASS_INIT_FUNC(uct_tcp_ep_t, uct_tcp_iface_t *iface, int fd,
     ucs_list_head_init(&self->list);
     ucs_queue_head_init(&self->pending_q);
     ucs_queue_head_init(&self->put_comp_q);
+    uct_tcp_pacer_init(&self->pacer, iface->config.pacing.burst);
 
     if (dest_addr != NULL) {
         memcpy(&self->peer_addr[0], dest_addr, iface->config.sockaddr_len);
@@ -1038,9 +1091,10 @@ void uct_tcp_ep_pending_queue_dispatch(uct_tcp_ep_t *ep)
     uct_pending_req_priv_queue_t *priv;
 
     uct_pending_queue_dispatch(priv, &ep->pending_q,
-                               uct_tcp_ep_ctx_buf_empty(&ep->tx));
-    if (uct_tcp_ep_ctx_buf_empty(&ep->tx)) {
-        ucs_assert(ucs_queue_is_empty(&ep->pending_q));
+                               uct_tcp_ep_ctx_buf_empty(&ep->tx) &&
+                               uct_tcp_ep_pacing_allowed(ep));
+    if (uct_tcp_ep_ctx_buf_empty(&ep->tx) &&
+        ucs_queue_is_empty(&ep->pending_q)) {
         uct_tcp_ep_mod_events(ep, 0, UCS_EVENT_SET_EVWRITE);
     }
 }
@@ -1120,6 +1174,7 @@ static inline ssize_t uct_tcp_ep_send(uct_tcp_ep_t *ep)
         return uct_tcp_ep_handle_send_err(ep, status);
     }
 
+    uct_tcp_ep_pacing_consume(ep, sent_length);
     uct_tcp_ep_tx_completed(ep, sent_length);
 
     ucs_assert(sent_length <= SSIZE_MAX);
@@ -1148,6 +1203,7 @@ static inline ssize_t uct_tcp_ep_sendv(uct_tcp_ep_t *ep)
         return status;
     }
 
+    uct_tcp_ep_pacing_consume(ep, sent_length);
     uct_tcp_ep_tx_completed(ep, sent_length);
 
     if (ep->tx.offset != ep->tx.length) {
@@ -1280,6 +1336,21 @@ static inline void uct_tcp_ep_handle_recv_err(uct_tcp_ep_t *ep,
     }
 }
 
+static void
+uct_tcp_ep_handle_checksum_err(uct_tcp_ep_t *ep, const char *msg_str)
+{
+    char str_remote_addr[UCS_SOCKADDR_STRING_LEN];
+
+    ucs_error("tcp_ep %p: %s checksum mismatch on data received from %s, "
+              "closing the connection", ep, msg_str,
+              ucs_sockaddr_str((const struct sockaddr*)&ep->peer_addr,
+                               str_remote_addr, UCS_SOCKADDR_STRING_LEN));
+
+    ep->flags &= ~(UCT_TCP_EP_FLAG_PUT_RX | UCT_TCP_EP_FLAG_PUT_RX_CHECKSUM);
+    uct_tcp_ep_ctx_reset(&ep->rx);
+    uct_tcp_ep_handle_disconnected(ep, UCS_ERR_IO_ERROR);
+}
+
 static inline unsigned uct_tcp_ep_recv(uct_tcp_ep_t *ep, size_t recv_length)
 {
     uct_tcp_iface_t UCS_V_UNUSED *iface = ucs_derived_of(ep->super.super.iface,
@@ -1328,7 +1399,8 @@ static unsigned uct_tcp_ep_progress_data_tx(void *arg)
 
     ucs_trace_func("ep=%p", ep);
 
-    if (uct_tcp_ep_ctx_buf_need_progress(&ep->tx)) {
+    if (uct_tcp_ep_ctx_buf_need_progress(&ep->tx) &&
+        uct_tcp_ep_pacing_allowed(ep)) {
         offset = (!(ep->flags & UCT_TCP_EP_FLAG_ZCOPY_TX) ?
                   uct_tcp_ep_send(ep) : uct_tcp_ep_sendv(ep));
         if (ucs_unlikely(offset < 0)) {
@@ -1371,16 +1443,53 @@ uct_tcp_ep_comp_recv_am(uct_tcp_iface_t *iface, uct_tcp_ep_t *ep,
     uct_iface_invoke_am(&iface->super, hdr->am_id, hdr + 1, hdr->length, 0);
 }
 
+static ucs_status_t
+uct_tcp_ep_am_check_checksum(uct_tcp_am_hdr_t *hdr)
+{
+    uint32_t checksum;
+
+    if (ucs_unlikely(hdr->length < sizeof(checksum))) {
+        return UCS_ERR_IO_ERROR;
+    }
+
+    /* Strip the checksum, so the message is handled as a regular one */
+    hdr->am_id  &= ~UCT_TCP_AM_ID_FLAG_CHECKSUM;
+    hdr->length -= sizeof(checksum);
+    memcpy(&checksum, UCS_PTR_BYTE_OFFSET(hdr + 1, hdr->length),
+           sizeof(checksum));
+
+    if (ucs_unlikely(ucs_crc32c(0, hdr + 1, hdr->length) != checksum)) {
+        return UCS_ERR_IO_ERROR;
+    }
+
+    return UCS_OK;
+}
+
 static inline ucs_status_t
 uct_tcp_ep_put_rx_advance(uct_tcp_ep_t *ep, uct_tcp_ep_put_req_hdr_t *put_req,
                           size_t recv_length)
 {
     ucs_assert(!(ep->flags & UCT_TCP_EP_FLAG_PUT_RX_SENDING_ACK));
     ucs_assert(recv_length <= put_req->length);
+
+    if (ucs_unlikely(ep->flags & UCT_TCP_EP_FLAG_PUT_RX_CHECKSUM)) {
+        ep->rx.put_checksum.value =
+                ucs_crc32c(ep->rx.put_checksum.value,
+                           (void*)(uintptr_t)put_req->addr, recv_length);
+    }
+
     put_req->addr   += recv_length;
     put_req->length -= recv_length;
 
     if (!put_req->length) {
+        if (ucs_unlikely(ep->flags & UCT_TCP_EP_FLAG_PUT_RX_CHECKSUM)) {
+            ep->flags &= ~UCT_TCP_EP_FLAG_PUT_RX_CHECKSUM;
+            if (ep->rx.put_checksum.value != ep->rx.put_checksum.expected) {
+                /* Don't acknowledge the corrupted PUT operation */
+                return UCS_ERR_IO_ERROR;
+            }
+        }
+
         uct_tcp_ep_post_put_ack(ep);
 
         /* EP's ctx_caps doesn't have UCT_TCP_EP_FLAG_PUT_RX flag
@@ -1397,15 +1506,28 @@ uct_tcp_ep_put_rx_advance(uct_tcp_ep_t *ep, uct_tcp_ep_put_req_hdr_t *put_req,
     return UCS_INPROGRESS;
 }
 
-static inline void uct_tcp_ep_handle_put_req(uct_tcp_ep_t *ep,
-                                             uct_tcp_ep_put_req_hdr_t *put_req,
-                                             size_t extra_recvd_length)
+static inline ucs_status_t
+uct_tcp_ep_handle_put_req(uct_tcp_ep_t *ep, uct_tcp_am_hdr_t *hdr,
+                          size_t extra_recvd_length)
 {
+    uct_tcp_ep_put_req_hdr_t *put_req = (uct_tcp_ep_put_req_hdr_t*)(hdr + 1);
+    uct_tcp_ep_put_req_checksum_t *put_checksum;
     size_t copied_length;
     ucs_status_t status;
 
     ucs_assert(put_req->addr || !put_req->length);
 
+    if (hdr->length > sizeof(*put_req)) {
+        /* PUT request was sent along with the checksum of the payload */
+        ucs_assert(hdr->length ==
+                   (sizeof(*put_req) + sizeof(put_checksum->data)));
+        put_checksum                 = (uct_tcp_ep_put_req_checksum_t*)
+                                       (put_req + 1);
+        ep->rx.put_checksum.expected = put_checksum->data;
+        ep->rx.put_checksum.value    = 0;
+        ep->flags                   |= UCT_TCP_EP_FLAG_PUT_RX_CHECKSUM;
+    }
+
     copied_length  = ucs_min(put_req->length, extra_recvd_length);
     memcpy((void*)(uintptr_t)put_req->addr,
            UCS_PTR_BYTE_OFFSET(ep->rx.buf, ep->rx.offset),
@@ -1420,8 +1542,8 @@ static inline void uct_tcp_ep_handle_put_req(uct_tcp_ep_t *ep,
     ep->flags &= ~UCT_TCP_EP_FLAG_PUT_RX_SENDING_ACK;
 
     status = uct_tcp_ep_put_rx_advance(ep, put_req, copied_length);
-    if (status == UCS_OK) {
-        return;
+    if (status != UCS_INPROGRESS) {
+        return status;
     }
 
     ucs_assert(ep->rx.offset == ep->rx.length);
@@ -1429,6 +1551,7 @@ static inline void uct_tcp_ep_handle_put_req(uct_tcp_ep_t *ep,
     /* Since RX buffer and PUT request can be overlapped, use memmove() */
     memmove(ep->rx.buf, put_req, sizeof(*put_req));
     ep->flags |= UCT_TCP_EP_FLAG_PUT_RX;
+    return UCS_INPROGRESS;
 }
 
 static unsigned uct_tcp_ep_progress_am_rx(uct_tcp_ep_t *ep)
@@ -1440,6 +1563,7 @@ static unsigned uct_tcp_ep_progress_am_rx(uct_tcp_ep_t *ep)
     size_t recv_length;
     size_t recvd_length;
     size_t remaining;
+    ucs_status_t status;
 
     ucs_trace_func("ep=%p", ep);
 
@@ -1499,6 +1623,13 @@ static unsigned uct_tcp_ep_progress_am_rx(uct_tcp_ep_t *ep)
         ep->rx.offset += sizeof(*hdr) + hdr->length;
         ucs_assert(ep->rx.offset <= ep->rx.length);
 
+        if (ucs_unlikely(hdr->am_id & UCT_TCP_AM_ID_FLAG_CHECKSUM) &&
+            (uct_tcp_ep_am_check_checksum(hdr) != UCS_OK)) {
+            uct_tcp_ep_handle_checksum_err(ep, "AM");
+            handled++;
+            goto out;
+        }
+
         if (ucs_likely(hdr->am_id < UCT_AM_ID_MAX)) {
             uct_tcp_ep_comp_recv_am(iface, ep, hdr);
             handled++;
@@ -1512,11 +1643,14 @@ static unsigned uct_tcp_ep_progress_am_rx(uct_tcp_ep_t *ep)
                 goto out;
             }
         } else if (hdr->am_id == UCT_TCP_EP_PUT_REQ_AM_ID) {
-            ucs_assert(hdr->length == sizeof(uct_tcp_ep_put_req_hdr_t));
-            uct_tcp_ep_handle_put_req(ep, (uct_tcp_ep_put_req_hdr_t*)(hdr + 1),
-                                      ep->rx.length - ep->rx.offset);
+            ucs_assert(hdr->length >= sizeof(uct_tcp_ep_put_req_hdr_t));
+            status = uct_tcp_ep_handle_put_req(ep, hdr,
+                                               ep->rx.length - ep->rx.offset);
             handled++;
-            if (ep->flags & UCT_TCP_EP_FLAG_PUT_RX) {
+            if (ucs_unlikely(UCS_STATUS_IS_ERR(status))) {
+                uct_tcp_ep_handle_checksum_err(ep, "PUT");
+                goto out;
+            } else if (ep->flags & UCT_TCP_EP_FLAG_PUT_RX) {
                 /* It means that PUT RX is in progress and EP RX buffer
                  * is used to keep PUT header. So, we don't need to
                  * release a EP RX buffer */
@@ -1595,7 +1729,10 @@ static unsigned uct_tcp_ep_progress_put_rx(uct_tcp_ep_t *ep)
 
     ucs_assertv(recv_length, "ep=%p", ep);
 
-    uct_tcp_ep_put_rx_advance(ep, put_req, recv_length);
+    status = uct_tcp_ep_put_rx_advance(ep, put_req, recv_length);
+    if (ucs_unlikely(UCS_STATUS_IS_ERR(status))) {
+        uct_tcp_ep_handle_checksum_err(ep, "PUT");
+    }
 
     return 1;
 }
@@ -1704,7 +1841,8 @@ uct_tcp_ep_am_send(uct_tcp_ep_t *ep, const uct_tcp_am_hdr_t *hdr)
         return (ucs_status_t)offset;
     }
 
-    uct_iface_trace_am(&iface->super, UCT_AM_TRACE_TYPE_SEND, hdr->am_id,
+    uct_iface_trace_am(&iface->super, UCT_AM_TRACE_TYPE_SEND,
+                       (uint8_t)(hdr->am_id & ~UCT_TCP_AM_ID_FLAG_CHECKSUM),
                        hdr + 1, hdr->length, "SEND: ep %p fd %d sent "
                        "%zu/%zu bytes, moved by offset %zd",
                        ep, ep->fd, ep->tx.offset, ep->tx.length, offset);
@@ -1751,9 +1889,11 @@ uct_tcp_ep_am_sendv(uct_tcp_ep_t *ep, int short_sendv, uct_tcp_am_hdr_t *hdr,
         return uct_tcp_ep_handle_send_err(ep, status);
     }
 
+    uct_tcp_ep_pacing_consume(ep, sent_length);
     uct_tcp_ep_tx_completed(ep, sent_length);
 
-    uct_iface_trace_am(&iface->super, UCT_AM_TRACE_TYPE_SEND, hdr->am_id,
+    uct_iface_trace_am(&iface->super, UCT_AM_TRACE_TYPE_SEND,
+                       (uint8_t)(hdr->am_id & ~UCT_TCP_AM_ID_FLAG_CHECKSUM),
                        /* the function will be invoked only in case of
                         * data tracing is enabled */
                        uct_tcp_ep_am_sendv_get_trace_payload(hdr, header, iov,
@@ -1812,6 +1952,46 @@ static void uct_tcp_ep_post_put_ack(uct_tcp_ep_t *ep)
     ep->flags &= ~UCT_TCP_EP_FLAG_PUT_RX_SENDING_ACK;
 }
 
+static UCS_F_ALWAYS_INLINE uint32_t
+uct_tcp_ep_iov_checksum(const struct iovec *iov, size_t iov_cnt)
+{
+    uint32_t checksum = 0;
+    size_t iov_it;
+
+    for (iov_it = 0; iov_it < iov_cnt; ++iov_it) {
+        checksum = ucs_crc32c(checksum, iov[iov_it].iov_base,
+                              iov[iov_it].iov_len);
+    }
+
+    return checksum;
+}
+
+/* Append the checksum of AM data which is placed right after the header */
+static UCS_F_ALWAYS_INLINE void uct_tcp_ep_am_set_checksum(uct_tcp_am_hdr_t *hdr)
+{
+    uint32_t checksum = ucs_crc32c(0, hdr + 1, hdr->length);
+
+    memcpy(UCS_PTR_BYTE_OFFSET(hdr + 1, hdr->length), &checksum,
+           sizeof(checksum));
+    hdr->am_id  |= UCT_TCP_AM_ID_FLAG_CHECKSUM;
+    hdr->length += sizeof(checksum);
+}
+
+/* Append an IOV with the checksum of AM data which is described by
+ * iov[1]..iov[iov_cnt - 1], iov[0] is the TCP AM header */
+static UCS_F_ALWAYS_INLINE size_t
+uct_tcp_ep_am_set_iov_checksum(uct_tcp_am_hdr_t *hdr, struct iovec *iov,
+                               size_t iov_cnt, uint32_t *checksum_p)
+{
+    *checksum_p           = uct_tcp_ep_iov_checksum(&iov[1], iov_cnt - 1);
+    iov[iov_cnt].iov_base = checksum_p;
+    iov[iov_cnt].iov_len  = sizeof(*checksum_p);
+    hdr->am_id           |= UCT_TCP_AM_ID_FLAG_CHECKSUM;
+    hdr->length          += sizeof(*checksum_p);
+
+    return iov_cnt + 1;
+}
+
 static inline ucs_status_t
 uct_tcp_ep_am_short_sendv(uct_tcp_ep_t *ep, uct_tcp_iface_t *iface,
                           uct_tcp_am_hdr_t *hdr, uint64_t header, struct iovec *iov,
@@ -1845,12 +2025,14 @@ ucs_status_t uct_tcp_ep_am_short(uct_ep_h uct_ep, uint8_t am_id, uint64_t header
     uct_tcp_ep_t *ep       = ucs_derived_of(uct_ep, uct_tcp_ep_t);
     uct_tcp_iface_t *iface = ucs_derived_of(uct_ep->iface, uct_tcp_iface_t);
     uct_tcp_am_hdr_t *hdr  = NULL;
-    struct iovec iov[UCT_TCP_EP_AM_SHORTV_IOV_COUNT];
+    struct iovec iov[UCT_TCP_EP_AM_SHORTV_IOV_COUNT + 1];
     uint32_t UCS_V_UNUSED payload_length;
+    size_t iov_cnt;
+    uint32_t checksum;
     ucs_status_t status;
 
     UCT_CHECK_LENGTH(length + sizeof(header), 0,
-                     iface->config.tx_seg_size - sizeof(uct_tcp_am_hdr_t),
+                     iface->config.tx_seg_size - UCT_TCP_AM_SERVICE_LENGTH,
                      "am_short");
     UCT_CHECK_AM_ID(am_id);
 
@@ -1868,6 +2050,10 @@ ucs_status_t uct_tcp_ep_am_short(uct_ep_h uct_ep, uint8_t am_id, uint64_t header
     if (length <= iface->config.sendv_thresh) {
         uct_am_short_fill_data(hdr + 1, header, payload, length,
                                UCS_ARCH_MEMCPY_NT_NONE);
+        if (iface->config.checksum) {
+            uct_tcp_ep_am_set_checksum(hdr);
+        }
+
         status = uct_tcp_ep_am_send(ep, hdr);
     } else {
         iov[0].iov_base = hdr;
@@ -1879,8 +2065,14 @@ ucs_status_t uct_tcp_ep_am_short(uct_ep_h uct_ep, uint8_t am_id, uint64_t header
         iov[2].iov_base = (void*)payload;
         iov[2].iov_len  = length;
 
+        iov_cnt         = UCT_TCP_EP_AM_SHORTV_IOV_COUNT;
+        if (iface->config.checksum) {
+            iov_cnt = uct_tcp_ep_am_set_iov_checksum(hdr, iov, iov_cnt,
+                                                     &checksum);
+        }
+
         status          = uct_tcp_ep_am_short_sendv(ep, iface, hdr, header, iov,
-                                                    UCT_TCP_EP_AM_SHORTV_IOV_COUNT);
+                                                    iov_cnt);
     }
 
     if (ucs_unlikely(status != UCS_OK)) {
@@ -1898,15 +2090,17 @@ ucs_status_t uct_tcp_ep_am_short_iov(uct_ep_h uct_ep, uint8_t am_id,
     uct_tcp_ep_t *ep       = ucs_derived_of(uct_ep, uct_tcp_ep_t);
     uct_tcp_iface_t *iface = ucs_derived_of(uct_ep->iface, uct_tcp_iface_t);
     uct_tcp_am_hdr_t *hdr  = NULL;
-    struct iovec *iov      = ucs_alloca((uct_iov_cnt + 1) * sizeof(*iov));
+    struct iovec *iov      = ucs_alloca((uct_iov_cnt + 2) * sizeof(*iov));
     ucs_iov_iter_t uct_iov_iter;
     size_t UCS_V_UNUSED payload_length;
+    size_t iov_cnt;
+    uint32_t checksum;
     ucs_status_t status;
 
     UCT_CHECK_AM_ID(am_id);
     UCT_CHECK_IOV_SIZE(uct_iov_cnt, iface->config.max_iov, "am_short_iov");
     UCT_CHECK_LENGTH(uct_iov_total_length(uct_iov, uct_iov_cnt), 0,
-                     iface->config.tx_seg_size - sizeof(uct_tcp_am_hdr_t),
+                     iface->config.tx_seg_size - UCT_TCP_AM_SERVICE_LENGTH,
                      "am_short_iov");
 
     status = uct_tcp_ep_am_prepare(iface, ep, am_id, &hdr);
@@ -1922,8 +2116,13 @@ ucs_status_t uct_tcp_ep_am_short_iov(uct_ep_h uct_ep, uint8_t am_id,
     hdr->length     = payload_length = uct_iov_to_iovec(&iov[1], &uct_iov_cnt,
                                                         uct_iov, uct_iov_cnt,
                                                         SIZE_MAX, &uct_iov_iter);
+    iov_cnt         = uct_iov_cnt + 1;
+    if (iface->config.checksum) {
+        iov_cnt = uct_tcp_ep_am_set_iov_checksum(hdr, iov, iov_cnt, &checksum);
+    }
+
     status          = uct_tcp_ep_am_short_sendv(ep, iface, hdr, 0, iov,
-                                                uct_iov_cnt + 1);
+                                                iov_cnt);
     if (ucs_unlikely(status != UCS_OK)) {
         return status;
     }
@@ -1955,6 +2154,9 @@ ssize_t uct_tcp_ep_am_bcopy(uct_ep_h uct_ep, uint8_t am_id,
     /* Save the length of the payload, because hdr (ep::buf)
      * can be released inside `uct_tcp_ep_am_send` call */
     hdr->length = payload_length = pack_cb(hdr + 1, arg);
+    if (iface->config.checksum) {
+        uct_tcp_ep_am_set_checksum(hdr);
+    }
 
     status = uct_tcp_ep_am_send(ep, hdr);
     if (ucs_unlikely(status != UCS_OK)) {
@@ -2027,7 +2229,7 @@ ucs_status_t uct_tcp_ep_am_zcopy(uct_ep_h uct_ep, uint8_t am_id, const void *hea
     ucs_status_t status;
 
     UCT_CHECK_LENGTH(header_length + uct_iov_total_length(iov, iovcnt), 0,
-                     iface->config.rx_seg_size - sizeof(uct_tcp_am_hdr_t),
+                     iface->config.rx_seg_size - UCT_TCP_AM_SERVICE_LENGTH,
                      "am_zcopy");
     UCT_CHECK_AM_ID(am_id);
 
@@ -2039,6 +2241,12 @@ ucs_status_t uct_tcp_ep_am_zcopy(uct_ep_h uct_ep, uint8_t am_id, const void *hea
     }
 
     ctx->super.length = payload_length + header_length;
+    if (iface->config.checksum) {
+        ucs_assert(ctx->iov_cnt < iface->config.max_iov);
+        ctx->iov_cnt = uct_tcp_ep_am_set_iov_checksum(&ctx->super, ctx->iov,
+                                                      ctx->iov_cnt,
+                                                      &ctx->checksum);
+    }
 
     status = uct_tcp_ep_am_sendv(ep, 0, &ctx->super, iface->config.rx_seg_size,
                                  header, ctx->iov, ctx->iov_cnt);
@@ -2090,15 +2298,24 @@ ucs_status_t uct_tcp_ep_put_zcopy(uct_ep_h uct_ep, const uct_iov_t *iov,
     uct_tcp_iface_t *iface           = ucs_derived_of(uct_ep->iface,
                                                       uct_tcp_iface_t);
     uct_tcp_ep_zcopy_tx_t *ctx       = NULL;
-    uct_tcp_ep_put_req_hdr_t put_req = {0}; /* Suppress Cppcheck false-positive */
+    struct {
+        uct_tcp_ep_put_req_hdr_t      hdr;
+        uct_tcp_ep_put_req_checksum_t checksum;
+    } UCS_S_PACKED put_req           = {{0}}; /* Suppress Cppcheck false-positive */
+    unsigned header_length;
     ucs_status_t status;
 
     UCT_CHECK_LENGTH(sizeof(put_req) + uct_iov_total_length(iov, iovcnt), 0,
                      UCT_TCP_EP_PUT_ZCOPY_MAX - sizeof(uct_tcp_am_hdr_t),
                      "put_zcopy");
 
+    header_length = sizeof(put_req.hdr);
+    if (iface->config.checksum) {
+        header_length += sizeof(put_req.checksum);
+    }
+
     status = uct_tcp_ep_prepare_zcopy(iface, ep, UCT_TCP_EP_PUT_REQ_AM_ID,
-                                      &put_req, sizeof(put_req),
+                                      &put_req, header_length,
                                       iov, iovcnt, "put_zcopy",
                                       /* Set a payload length directly to the
                                        * TX length, since PUT Zcopy doesn't
@@ -2108,10 +2325,21 @@ ucs_status_t uct_tcp_ep_put_zcopy(uct_ep_h uct_ep, const uct_iov_t *iov,
         return status;
     }
 
-    ctx->super.length = sizeof(put_req);
-    put_req.addr      = remote_addr;
-    put_req.length    = ep->tx.length;
-    put_req.sn        = ep->tx.put_sn + 1;
+    ctx->super.length  = header_length;
+    put_req.hdr.addr   = remote_addr;
+    put_req.hdr.length = ep->tx.length;
+    put_req.hdr.sn     = ep->tx.put_sn + 1;
+
+    if (iface->config.checksum) {
+        /* iov[0] is TCP AM header, iov[1] is PUT request header, so the
+         * payload starts from iov[2] */
+        put_req.checksum.data = uct_tcp_ep_iov_checksum(&ctx->iov[2],
+                                                        ctx->iov_cnt - 2);
+        put_req.checksum.hdr  = ucs_crc32c(0, &put_req,
+                                           sizeof(put_req.hdr) +
+                                           sizeof(put_req.checksum.data));
+        ctx->super.am_id     |= UCT_TCP_AM_ID_FLAG_CHECKSUM;
+    }
 
     status = uct_tcp_ep_am_sendv(ep, 0, &ctx->super, UCT_TCP_EP_PUT_ZCOPY_MAX,
                                  &put_req, ctx->iov, ctx->iov_cnt);
@@ -2131,16 +2359,16 @@ ucs_status_t uct_tcp_ep_put_zcopy(uct_ep_h uct_ep, const uct_iov_t *iov,
         uct_tcp_iface_outstanding_inc(iface);
     }
 
-    UCT_TL_EP_STAT_OP(&ep->super, PUT, ZCOPY, put_req.length);
+    UCT_TL_EP_STAT_OP(&ep->super, PUT, ZCOPY, put_req.hdr.length);
 
-    status = uct_tcp_ep_put_comp_add(ep, comp, put_req.sn);
+    status = uct_tcp_ep_put_comp_add(ep, comp, put_req.hdr.sn);
     if (ucs_unlikely(status != UCS_OK)) {
         return status;
     }
 
     if (uct_tcp_ep_ctx_buf_need_progress(&ep->tx)) {
         uct_tcp_ep_set_outstanding_zcopy(iface, ep, ctx, &put_req,
-                                         sizeof(put_req), NULL);
+                                         header_length, NULL);
     }
 
     return UCS_INPROGRESS;
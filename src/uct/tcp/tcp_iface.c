@@ -54,6 +54,13 @@ static ucs_config_field_t uct_tcp_iface_config_table[] = {
    "Enable PUT Zcopy support",
    ucs_offsetof(uct_tcp_iface_config_t, put_enable), UCS_CONFIG_TYPE_BOOL},
 
+  {"CHECKSUM", "n",
+   "Protect active messages and PUT Zcopy data by CRC32C checksum, which is\n"
+   "verified by the receiver. A connection which delivered corrupted data is\n"
+   "closed and reported as failed. The checksum is calculated by CPU crc32\n"
+   "instructions when they are available.",
+   ucs_offsetof(uct_tcp_iface_config_t, checksum), UCS_CONFIG_TYPE_BOOL},
+
   {"CONN_NB", "n",
    "Enable non-blocking connection establishment. It may improve startup "
    "time, but can lead to connection resets due to high load on TCP/IP stack",
@@ -92,6 +99,23 @@ static ucs_config_field_t uct_tcp_iface_config_table[] = {
     "Upper bound to TCP iface bandwidth. 'auto' means BW is unlimited.",
     ucs_offsetof(uct_tcp_iface_config_t, max_bw), UCS_CONFIG_TYPE_BW},
 
+  {"PACING_RATE", "auto",
+   "Upper bound to the sending rate of the interface, shared by all its\n"
+   "endpoints. Operations which exceed it are delayed in the pending queue.\n"
+   "'auto' means the rate is not limited.",
+   ucs_offsetof(uct_tcp_iface_config_t, pacing.iface_rate), UCS_CONFIG_TYPE_BW},
+
+  {"EP_PACING_RATE", "auto",
+   "Upper bound to the sending rate of each endpoint. The rate is also passed\n"
+   "to the kernel by SO_MAX_PACING_RATE socket option, if it is supported.\n"
+   "'auto' means the rate is not limited.",
+   ucs_offsetof(uct_tcp_iface_config_t, pacing.ep_rate), UCS_CONFIG_TYPE_BW},
+
+  {"PACING_BURST", "64kb",
+   "Maximal amount of data which can be sent at once after an idle period,\n"
+   "when the sending rate is limited by PACING_RATE or EP_PACING_RATE.",
+   ucs_offsetof(uct_tcp_iface_config_t, pacing.burst), UCS_CONFIG_TYPE_MEMUNITS},
+
 #ifdef UCT_TCP_EP_KEEPALIVE
   {"KEEPIDLE", UCS_PP_MAKE_STRING(UCT_TCP_EP_DEFAULT_KEEPALIVE_IDLE) "s",
    "The time the connection needs to remain idle before TCP starts sending "
@@ -311,7 +335,7 @@ static ucs_status_t uct_tcp_iface_query(uct_iface_h tl_iface,
 {
     uct_tcp_iface_t *iface = ucs_derived_of(tl_iface, uct_tcp_iface_t);
     size_t am_buf_size     = iface->config.tx_seg_size -
-                             sizeof(uct_tcp_am_hdr_t);
+                             UCT_TCP_AM_SERVICE_LENGTH;
     ucs_status_t status;
     int is_default;
     double pci_bw, network_bw, calculated_bw;
@@ -336,6 +360,10 @@ static ucs_status_t uct_tcp_iface_query(uct_iface_h tl_iface,
 
     /* Bandwidth is bounded by TCP stack computation time */
     attr->bandwidth.shared = ucs_min(calculated_bw, iface->config.max_bw);
+    if (iface->config.pacing.iface_rate > 0) {
+        attr->bandwidth.shared = ucs_min(attr->bandwidth.shared,
+                                         iface->config.pacing.iface_rate);
+    }
 
     attr->ep_addr_len      = sizeof(uct_tcp_ep_addr_t);
     attr->iface_addr_len   = sizeof(uct_tcp_iface_addr_t);
@@ -365,7 +393,7 @@ static ucs_status_t uct_tcp_iface_query(uct_iface_h tl_iface,
         attr->cap.am.max_iov          = iface->config.max_iov -
                                         UCT_TCP_EP_ZCOPY_SERVICE_IOV_COUNT;
         attr->cap.am.max_zcopy        = iface->config.rx_seg_size -
-                                        sizeof(uct_tcp_am_hdr_t);
+                                        UCT_TCP_AM_SERVICE_LENGTH;
         attr->cap.am.max_hdr          = iface->config.zcopy.max_hdr;
         attr->cap.am.opt_zcopy_align  = 1;
         attr->cap.flags              |= UCT_IFACE_FLAG_AM_ZCOPY;
@@ -505,6 +533,9 @@ uct_tcp_iface_connect_handler(int listen_fd, ucs_event_set_types_t events,
 ucs_status_t uct_tcp_iface_set_sockopt(uct_tcp_iface_t *iface, int fd,
                                        int set_nb)
 {
+#ifdef SO_MAX_PACING_RATE
+    uint32_t pacing_rate;
+#endif
     ucs_status_t status;
 
     if (set_nb) {
@@ -527,6 +558,19 @@ ucs_status_t uct_tcp_iface_set_sockopt(uct_tcp_iface_t *iface, int fd,
         return status;
     }
 
+#ifdef SO_MAX_PACING_RATE
+    if (iface->config.pacing.ep_rate > 0) {
+        pacing_rate = ucs_min(iface->config.pacing.ep_rate, UINT32_MAX);
+        /* Kernel pacing is best effort, the rate is enforced by the endpoint
+         * token bucket anyway */
+        if (setsockopt(fd, SOL_SOCKET, SO_MAX_PACING_RATE, &pacing_rate,
+                       sizeof(pacing_rate)) < 0) {
+            ucs_debug("fd %d: failed to set SO_MAX_PACING_RATE to %u: %m", fd,
+                      pacing_rate);
+        }
+    }
+#endif
+
     return ucs_tcp_base_set_syn_cnt(fd, iface->config.syn_cnt);
 }
 
@@ -712,12 +756,16 @@ static UCS_CLASS_INIT_FUNC(uct_tcp_iface_t, uct_md_h md, uct_worker_h worker,
     ucs_strncpy_zero(self->if_name, params->mode.device.dev_name,
                      sizeof(self->if_name));
     self->outstanding        = 0;
+    /* Always reserve a space for the checksum, since the peer may have it
+     * enabled */
     self->config.tx_seg_size = config->tx_seg_size +
-                               sizeof(uct_tcp_am_hdr_t);
+                               UCT_TCP_AM_SERVICE_LENGTH;
     self->config.rx_seg_size = config->rx_seg_size +
-                               sizeof(uct_tcp_am_hdr_t);
+                               UCT_TCP_AM_SERVICE_LENGTH;
+    self->config.checksum    = config->checksum;
 
-    if (ucs_iov_get_max() >= UCT_TCP_EP_AM_SHORTV_IOV_COUNT) {
+    if (ucs_iov_get_max() >= (UCT_TCP_EP_AM_SHORTV_IOV_COUNT +
+                              !!self->config.checksum)) {
         self->config.sendv_thresh = config->sendv_thresh;
     } else {
         /* AM Short with non-blocking vector send can't be used */
@@ -726,7 +774,8 @@ static UCS_CLASS_INIT_FUNC(uct_tcp_iface_t, uct_md_h md, uct_worker_h worker,
 
     /* Maximum IOV count allowed by user's configuration (considering TCP
      * protocol and user's AM headers that use 1st and 2nd IOVs
-     * correspondingly) and system constraints */
+     * correspondingly, and the checksum which follows the payload) and
+     * system constraints */
     self->config.max_iov          = ucs_min(config->max_iov +
                                             UCT_TCP_EP_ZCOPY_SERVICE_IOV_COUNT,
                                             ucs_iov_get_max());
@@ -782,6 +831,23 @@ static UCS_CLASS_INIT_FUNC(uct_tcp_iface_t, uct_md_h md, uct_worker_h worker,
                                   DBL_MAX :
                                   config->max_bw;
 
+    self->config.pacing.iface_rate =
+            UCS_CONFIG_DBL_IS_AUTO(config->pacing.iface_rate) ?
+                    0 : config->pacing.iface_rate;
+    self->config.pacing.ep_rate    =
+            UCS_CONFIG_DBL_IS_AUTO(config->pacing.ep_rate) ?
+                    0 : config->pacing.ep_rate;
+    self->config.pacing.burst      = config->pacing.burst;
+    self->config.pacing.enable     = (self->config.pacing.iface_rate > 0) ||
+                                     (self->config.pacing.ep_rate > 0);
+    if (self->config.pacing.enable && (config->pacing.burst == 0)) {
+        ucs_error("pacing burst size must be greater than 0");
+        status = UCS_ERR_INVALID_PARAM;
+        goto err;
+    }
+
+    uct_tcp_pacer_init(&self->pacer, self->config.pacing.burst);
+
     if (self->config.tx_seg_size > self->config.rx_seg_size) {
         ucs_error("RX segment size (%zu) must be >= TX segment size (%zu)",
                   self->config.rx_seg_size, self->config.tx_seg_size);
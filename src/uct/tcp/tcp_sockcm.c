@@ -26,9 +26,31 @@ ucs_config_field_t uct_tcp_sockcm_config_table[] = {
 
    UCT_TCP_SYN_CNT(ucs_offsetof(uct_tcp_sockcm_config_t, syn_cnt)),
 
+  {"MAX_CONNECTING", "256",
+   "Maximal number of client connections which are in the middle of the\n"
+   "connection establishment handshake. Connections beyond this limit are\n"
+   "queued and started as in-flight handshakes complete, which avoids\n"
+   "overflowing the backlog of the remote listeners when many endpoints are\n"
+   "created at once. \"inf\" means no limit.",
+   ucs_offsetof(uct_tcp_sockcm_config_t, max_connecting), UCS_CONFIG_TYPE_ULUNITS},
+
   {NULL}
 };
 
+#ifdef ENABLE_STATS
+static ucs_stats_class_t uct_tcp_sockcm_stats_class = {
+    .name          = "tcp_sockcm",
+    .num_counters  = UCT_TCP_SOCKCM_STAT_LAST,
+    .class_id      = UCS_STATS_CLASS_ID_INVALID,
+    .counter_names = {
+        [UCT_TCP_SOCKCM_STAT_CONNECT_STARTED]     = "connect_started",
+        [UCT_TCP_SOCKCM_STAT_CONNECT_DEFERRED]    = "connect_deferred",
+        [UCT_TCP_SOCKCM_STAT_CONNECT_ESTABLISHED] = "connect_established",
+        [UCT_TCP_SOCKCM_STAT_CONNECT_FAILED]      = "connect_failed"
+    }
+};
+#endif
+
 static ucs_status_t uct_tcp_sockcm_query(uct_cm_h cm, uct_cm_attr_t *cm_attr)
 {
     uct_tcp_sockcm_t *tcp_sockcm = ucs_derived_of(cm, uct_tcp_sockcm_t);
@@ -211,6 +233,7 @@ UCS_CLASS_INIT_FUNC(uct_tcp_sockcm_t, uct_component_h component,
 {
     uct_tcp_sockcm_config_t *cm_config = ucs_derived_of(config,
                                                         uct_tcp_sockcm_config_t);
+    ucs_status_t status;
 
     UCS_CLASS_CALL_SUPER_INIT(uct_cm_t, &uct_tcp_sockcm_ops,
                               &uct_tcp_sockcm_iface_ops,
@@ -222,8 +245,22 @@ UCS_CLASS_INIT_FUNC(uct_tcp_sockcm_t, uct_component_h component,
     self->sockopt_sndbuf = cm_config->sockopt.sndbuf;
     self->sockopt_rcvbuf = cm_config->sockopt.rcvbuf;
     self->syn_cnt        = cm_config->syn_cnt;
+    self->max_connecting = cm_config->max_connecting;
+    self->num_connecting = 0;
+
+    if (self->max_connecting == 0) {
+        ucs_error("TCP_CM_MAX_CONNECTING must be a positive number");
+        return UCS_ERR_INVALID_PARAM;
+    }
 
     ucs_list_head_init(&self->ep_list);
+    ucs_list_head_init(&self->connect_q);
+
+    status = UCS_STATS_NODE_ALLOC(&self->stats, &uct_tcp_sockcm_stats_class,
+                                  self->super.iface.stats, "-%p", self);
+    if (status != UCS_OK) {
+        return status;
+    }
 
     ucs_debug("created tcp_sockcm %p", self);
 
@@ -240,7 +277,13 @@ UCS_CLASS_CLEANUP_FUNC(uct_tcp_sockcm_t)
         uct_tcp_sockcm_close_ep(ep);
     }
 
+    ucs_assertv(ucs_list_is_empty(&self->connect_q),
+                "tcp_sockcm %p: %lu client endpoints were not destroyed", self,
+                ucs_list_length(&self->connect_q));
+
     UCS_ASYNC_UNBLOCK(self->super.iface.worker->async);
+
+    UCS_STATS_NODE_FREE(self->stats);
 }
 
 UCS_CLASS_DEFINE(uct_tcp_sockcm_t, uct_cm_t);
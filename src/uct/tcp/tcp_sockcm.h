@@ -11,6 +11,15 @@
 typedef struct uct_tcp_sockcm_ep   uct_tcp_sockcm_ep_t;
 
 
+enum {
+    UCT_TCP_SOCKCM_STAT_CONNECT_STARTED,
+    UCT_TCP_SOCKCM_STAT_CONNECT_DEFERRED,
+    UCT_TCP_SOCKCM_STAT_CONNECT_ESTABLISHED,
+    UCT_TCP_SOCKCM_STAT_CONNECT_FAILED,
+    UCT_TCP_SOCKCM_STAT_LAST
+};
+
+
 /**
  * A TCP connection manager
  */
@@ -21,6 +30,11 @@ typedef struct uct_tcp_sockcm {
     size_t              sockopt_rcvbuf;  /** SO_RCVBUF */
     unsigned            syn_cnt;         /** TCP_SYNCNT */
     ucs_list_link_t     ep_list;         /** List of endpoints */
+    unsigned long       max_connecting;  /** Max client handshakes in flight */
+    unsigned long       num_connecting;  /** Client handshakes in flight */
+    ucs_list_link_t     connect_q;       /** Client endpoints waiting for
+                                             their turn to connect */
+    UCS_STATS_NODE_DECLARE(stats)
 } uct_tcp_sockcm_t;
 
 /**
@@ -31,6 +45,7 @@ typedef struct uct_tcp_sockcm_config {
     size_t                          priv_data_len;
     uct_tcp_send_recv_buf_config_t  sockopt;
     unsigned                        syn_cnt;
+    unsigned long                   max_connecting;
 } uct_tcp_sockcm_config_t;
 
 
@@ -49,10 +49,33 @@ static int uct_tcp_sockcm_ep_is_connected(uct_tcp_sockcm_ep_t *cep)
                          UCT_TCP_SOCKCM_EP_SERVER_NOTIFY_CB_INVOKED);
 }
 
+static void uct_tcp_sockcm_connect_progress(uct_tcp_sockcm_t *tcp_sockcm);
+
+static void uct_tcp_sockcm_ep_client_connect_done(uct_tcp_sockcm_ep_t *cep,
+                                                  ucs_status_t status)
+{
+    uct_tcp_sockcm_t *tcp_sockcm = uct_tcp_sockcm_ep_get_cm(cep);
+
+    if (!(cep->state & UCT_TCP_SOCKCM_EP_CLIENT_CONNECTING)) {
+        return;
+    }
+
+    ucs_assert(tcp_sockcm->num_connecting > 0);
+    cep->state &= ~UCT_TCP_SOCKCM_EP_CLIENT_CONNECTING;
+    --tcp_sockcm->num_connecting;
+    UCS_STATS_UPDATE_COUNTER(tcp_sockcm->stats, (status == UCS_OK) ?
+                             UCT_TCP_SOCKCM_STAT_CONNECT_ESTABLISHED :
+                             UCT_TCP_SOCKCM_STAT_CONNECT_FAILED, 1);
+
+    /* the handshake slot is free, let a queued endpoint use it */
+    uct_tcp_sockcm_connect_progress(tcp_sockcm);
+}
+
 static void uct_tcp_sockcm_ep_client_connect_cb(uct_tcp_sockcm_ep_t *cep,
                                                 uct_cm_remote_data_t *remote_data,
                                                 ucs_status_t status)
 {
+    uct_tcp_sockcm_ep_client_connect_done(cep, status);
     cep->state |= UCT_TCP_SOCKCM_EP_CLIENT_CONNECTED_CB_INVOKED;
     uct_cm_ep_client_connect_cb(&cep->super, remote_data, status);
 }
@@ -338,6 +361,7 @@ void uct_tcp_sockcm_ep_handle_event_status(uct_tcp_sockcm_ep_t *ep,
         }
 
         ep->state |= UCT_TCP_SOCKCM_EP_FAILED;
+        uct_tcp_sockcm_ep_client_connect_done(ep, status);
     }
 }
 
@@ -852,6 +876,78 @@ ucs_status_t uct_tcp_sockcm_ep_set_sockopt(uct_tcp_sockcm_ep_t *ep)
     return ucs_tcp_base_set_syn_cnt(ep->fd, tcp_sockcm->syn_cnt);
 }
 
+/**
+ * The caller has to block async.
+ */
+static ucs_status_t
+uct_tcp_sockcm_ep_client_connect_start(uct_tcp_sockcm_ep_t *cep)
+{
+    uct_tcp_sockcm_t *tcp_sockcm   = uct_tcp_sockcm_ep_get_cm(cep);
+    ucs_async_context_t *async_ctx = tcp_sockcm->super.iface.worker->async;
+    ucs_status_t status;
+
+    /* try to connect to the server */
+    status = ucs_socket_connect(cep->fd,
+                                (const struct sockaddr*)&cep->server_addr);
+    if (UCS_STATUS_IS_ERR(status)) {
+        return status;
+    }
+    ucs_assert((status == UCS_OK) || (status == UCS_INPROGRESS));
+
+    status = ucs_async_set_event_handler(async_ctx->mode, cep->fd,
+                                         UCS_EVENT_SET_EVWRITE,
+                                         uct_tcp_sa_data_handler, cep,
+                                         async_ctx);
+    if (status != UCS_OK) {
+        return status;
+    }
+
+    cep->state |= UCT_TCP_SOCKCM_EP_CLIENT_CONNECTING;
+    ++tcp_sockcm->num_connecting;
+    UCS_STATS_UPDATE_COUNTER(tcp_sockcm->stats,
+                             UCT_TCP_SOCKCM_STAT_CONNECT_STARTED, 1);
+    return UCS_OK;
+}
+
+/**
+ * Start queued client connections while the in-flight limit allows.
+ * The caller has to block async.
+ */
+static void uct_tcp_sockcm_connect_progress(uct_tcp_sockcm_t *tcp_sockcm)
+{
+    uct_cm_remote_data_t remote_data;
+    uct_tcp_sockcm_ep_t *cep;
+    ucs_status_t status;
+
+    while ((tcp_sockcm->num_connecting < tcp_sockcm->max_connecting) &&
+           !ucs_list_is_empty(&tcp_sockcm->connect_q)) {
+        cep = ucs_list_extract_head(&tcp_sockcm->connect_q,
+                                    uct_tcp_sockcm_ep_t, list);
+        ucs_assert(cep->state & UCT_TCP_SOCKCM_EP_CLIENT_CONNECT_DEFERRED);
+        cep->state &= ~UCT_TCP_SOCKCM_EP_CLIENT_CONNECT_DEFERRED;
+
+        status = uct_tcp_sockcm_ep_client_connect_start(cep);
+        if (status == UCS_OK) {
+            continue;
+        }
+
+        /* the endpoint was already returned to the user, so report the
+         * failure through the first callback the user expects */
+        ucs_diag("tcp_sockcm %p: deferred connect of ep %p failed: %s",
+                 tcp_sockcm, cep, ucs_status_string(status));
+        UCS_STATS_UPDATE_COUNTER(tcp_sockcm->stats,
+                                 UCT_TCP_SOCKCM_STAT_CONNECT_FAILED, 1);
+        if (cep->super.resolve_cb != NULL) {
+            uct_tcp_sockcm_ep_invoke_resolve_cb(cep, "", status);
+        } else {
+            remote_data.field_mask = 0;
+            uct_tcp_sockcm_ep_client_connect_cb(cep, &remote_data, status);
+        }
+
+        cep->state |= UCT_TCP_SOCKCM_EP_FAILED;
+    }
+}
+
 static ucs_status_t uct_tcp_sockcm_ep_client_init(uct_tcp_sockcm_ep_t *cep,
                                                   const uct_ep_params_t *params)
 {
@@ -904,25 +1000,37 @@ static ucs_status_t uct_tcp_sockcm_ep_client_init(uct_tcp_sockcm_ep_t *cep,
         }
     }
 
-    /* try to connect to the server */
-    status = ucs_socket_connect(cep->fd, server_addr);
-    if (UCS_STATUS_IS_ERR(status)) {
+    status = ucs_sockaddr_copy((struct sockaddr*)&cep->server_addr,
+                               server_addr);
+    if (status != UCS_OK) {
         goto err_close_socket;
     }
-    ucs_assert((status == UCS_OK) || (status == UCS_INPROGRESS));
 
     async_ctx = tcp_sockcm->super.iface.worker->async;
-    status    = ucs_async_set_event_handler(async_ctx->mode, cep->fd,
-                                            UCS_EVENT_SET_EVWRITE,
-                                            uct_tcp_sa_data_handler, cep,
-                                            async_ctx);
+    UCS_ASYNC_BLOCK(async_ctx);
+
+    if (tcp_sockcm->num_connecting >= tcp_sockcm->max_connecting) {
+        /* too many handshakes in flight, connect when one of them completes */
+        cep->state |= UCT_TCP_SOCKCM_EP_CLIENT_CONNECT_DEFERRED;
+        ucs_list_add_tail(&tcp_sockcm->connect_q, &cep->list);
+        UCS_STATS_UPDATE_COUNTER(tcp_sockcm->stats,
+                                 UCT_TCP_SOCKCM_STAT_CONNECT_DEFERRED, 1);
+        status = UCS_OK;
+    } else {
+        status = uct_tcp_sockcm_ep_client_connect_start(cep);
+    }
+
+    UCS_ASYNC_UNBLOCK(async_ctx);
+
     if (status != UCS_OK) {
         goto err_close_socket;
     }
 
     ucs_debug("created a TCP SOCKCM endpoint (fd=%d) on tcp cm %p, "
-              "remote addr: %s", cep->fd, tcp_sockcm,
-              ucs_sockaddr_str(server_addr, ip_port_str, UCS_SOCKADDR_STRING_LEN));
+              "remote addr: %s%s", cep->fd, tcp_sockcm,
+              ucs_sockaddr_str(server_addr, ip_port_str, UCS_SOCKADDR_STRING_LEN),
+              (cep->state & UCT_TCP_SOCKCM_EP_CLIENT_CONNECT_DEFERRED) ?
+              " (deferred)" : "");
 
     return status;
 
@@ -1169,6 +1277,12 @@ UCS_CLASS_CLEANUP_FUNC(uct_tcp_sockcm_ep_t)
               (self->state & UCT_TCP_SOCKCM_EP_ON_SERVER) ? "server" : "client",
               self, self->state, tcp_sockcm);
 
+    if (self->state & UCT_TCP_SOCKCM_EP_CLIENT_CONNECT_DEFERRED) {
+        ucs_list_del(&self->list);
+    }
+
+    uct_tcp_sockcm_ep_client_connect_done(self, UCS_ERR_CANCELED);
+
     ucs_free(self->comm_ctx.buf);
 
     uct_tcp_sockcm_ep_close_fd(&self->fd);
@@ -29,7 +29,9 @@ typedef enum uct_tcp_sockcm_ep_state {
     UCT_TCP_SOCKCM_EP_SERVER_REJECT_SENT          = UCS_BIT(17), /* ep on the server sent the reject message to the client */
     UCT_TCP_SOCKCM_EP_RESOLVE_CB_FAILED           = UCS_BIT(18), /* the upper layer's resolve_cb failed */
     UCT_TCP_SOCKCM_EP_RESOLVE_CB_INVOKED          = UCS_BIT(19), /* resolve_cb invoked */
-    UCT_TCP_SOCKCM_EP_SERVER_CONN_REQ_CB_INVOKED  = UCS_BIT(20)  /* server ep was passed to a user via conn_req_cb */
+    UCT_TCP_SOCKCM_EP_SERVER_CONN_REQ_CB_INVOKED  = UCS_BIT(20), /* server ep was passed to a user via conn_req_cb */
+    UCT_TCP_SOCKCM_EP_CLIENT_CONNECT_DEFERRED     = UCS_BIT(21), /* ep on the client waits on the cm connect_q */
+    UCT_TCP_SOCKCM_EP_CLIENT_CONNECTING           = UCS_BIT(22)  /* ep on the client counts as an in-flight handshake */
 } uct_tcp_sockcm_ep_state_t;
 
 
@@ -41,7 +43,9 @@ struct uct_tcp_sockcm_ep {
     int                fd;        /* the fd of the socket on the ep */
     uint32_t           state;     /* ep state (uct_tcp_sockcm_ep_state_t) */
     uct_tcp_listener_t *listener; /* the listener the ep belongs to - used on the server side */
-    ucs_list_link_t    list;      /* list item on the cm ep_list - used on the server side */
+    ucs_list_link_t    list;      /* list item on the cm ep_list - used on the server side,
+                                     or on the cm connect_q - used on the client side */
+    struct sockaddr_storage server_addr; /* the address to connect to - used on the client side */
     struct {
         void           *buf;      /* Data buffer to send/recv */
         size_t         length;    /* How much data to send/recv */
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) NVIDIA CORPORATION & AFFILIATES, 2025. ALL RIGHTS RESERVED.
+ *
+ * See file LICENSE for terms.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <ucm/api/ucm.h>
+#include <ucm/util/sys.h>
+
+
+#define DEFAULT_THREAD_COUNT 8
+#define DEFAULT_ITER_COUNT   1000000
+#define DEFAULT_MAX_SIZE     256
+#define NUM_SLOTS            1024
+
+
+enum {
+    MODE_GLIBC,  /* Original allocator, UCM hooks are not installed */
+    MODE_UCM,    /* UCM allocator with a global heap */
+    MODE_ARENAS  /* UCM allocator with per-thread arenas */
+};
+
+
+static const char *mode_names[] = {
+    [MODE_GLIBC]  = "glibc",
+    [MODE_UCM]    = "ucm",
+    [MODE_ARENAS] = "arenas"
+};
+
+
+typedef struct {
+    int               thread_count;
+    long              iter_count;
+    size_t            max_size;
+    pthread_barrier_t barrier;
+} context_t;
+
+
+static void empty_event_cb(ucm_event_type_t event_type, ucm_event_t *event,
+                           void *arg)
+{
+}
+
+static void *thread_handler(void *arg)
+{
+    context_t *ctx = arg;
+    unsigned seed  = (unsigned)(uintptr_t)&seed;
+    void *slots[NUM_SLOTS];
+    long i;
+    int j;
+
+    memset(slots, 0, sizeof(slots));
+    pthread_barrier_wait(&ctx->barrier);
+
+    for (i = 0; i < ctx->iter_count; ++i) {
+        j = i % NUM_SLOTS;
+        free(slots[j]);
+        slots[j] = malloc(1 + (rand_r(&seed) % ctx->max_size));
+        if (slots[j] == NULL) {
+            printf("malloc() failed\n");
+            exit(EXIT_FAILURE);
+        }
+
+        /* Make sure the allocation is not optimized out */
+        *(volatile char*)slots[j] = (char)i;
+    }
+
+    for (j = 0; j < NUM_SLOTS; ++j) {
+        free(slots[j]);
+    }
+
+    pthread_barrier_wait(&ctx->barrier);
+    return NULL;
+}
+
+static int set_mode(int mode, int thread_count)
+{
+    ucs_status_t status;
+
+    if (mode == MODE_GLIBC) {
+        return 0;
+    }
+
+    ucm_global_opts.malloc_arenas = (mode == MODE_ARENAS) ? thread_count : 0;
+
+    /* Setting a memory event handler installs the malloc hooks */
+    status = ucm_set_event_handler(UCM_EVENT_VM_UNMAPPED, 0, empty_event_cb,
+                                   NULL);
+    if (status != UCS_OK) {
+        printf("failed to install memory hooks: status %d\n", status);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void usage(const char *argv0)
+{
+    printf("Usage: %s [options]\n", argv0);
+    printf("Measure malloc/free throughput of multiple threads.\n");
+    printf("Options:\n");
+    printf("  -m <mode> : Allocator to test (default: arenas)\n");
+    printf("                glibc  - original allocator\n");
+    printf("                ucm    - UCM allocator, global heap\n");
+    printf("                arenas - UCM allocator, per-thread arenas\n");
+    printf("  -n <num>  : Number of threads (default: %d)\n",
+           DEFAULT_THREAD_COUNT);
+    printf("  -i <num>  : Number of allocations per thread (default: %d)\n",
+           DEFAULT_ITER_COUNT);
+    printf("  -s <size> : Maximal allocation size (default: %d)\n",
+           DEFAULT_MAX_SIZE);
+    printf("  -h        : Display help message\n");
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    int mode = MODE_ARENAS;
+    context_t ctx;
+    pthread_t *threads;
+    double start_time, elapsed;
+    int c, i;
+
+    ctx.thread_count = DEFAULT_THREAD_COUNT;
+    ctx.iter_count   = DEFAULT_ITER_COUNT;
+    ctx.max_size     = DEFAULT_MAX_SIZE;
+
+    while ((c = getopt(argc, argv, "m:n:i:s:h")) != -1) {
+        switch (c) {
+        case 'm':
+            for (mode = 0; mode <= MODE_ARENAS; ++mode) {
+                if (!strcmp(optarg, mode_names[mode])) {
+                    break;
+                }
+            }
+            if (mode > MODE_ARENAS) {
+                usage(argv[0]);
+                return -1;
+            }
+            break;
+        case 'n':
+            ctx.thread_count = atoi(optarg);
+            break;
+        case 'i':
+            ctx.iter_count = atol(optarg);
+            break;
+        case 's':
+            ctx.max_size = atol(optarg);
+            break;
+        case 'h':
+        default:
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if ((ctx.thread_count <= 0) || (ctx.max_size == 0)) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    if (set_mode(mode, ctx.thread_count) != 0) {
+        return -1;
+    }
+
+    threads = calloc(ctx.thread_count, sizeof(*threads));
+    if (threads == NULL) {
+        printf("failed to allocate threads array\n");
+        return -1;
+    }
+
+    pthread_barrier_init(&ctx.barrier, NULL, ctx.thread_count + 1);
+    for (i = 0; i < ctx.thread_count; ++i) {
+        if (pthread_create(&threads[i], NULL, thread_handler, &ctx) != 0) {
+            printf("pthread_create(thread #%d) failed: %m\n", i);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    pthread_barrier_wait(&ctx.barrier);
+    start_time = ucm_get_time();
+    pthread_barrier_wait(&ctx.barrier);
+    elapsed    = ucm_get_time() - start_time;
+
+    for (i = 0; i < ctx.thread_count; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_barrier_destroy(&ctx.barrier);
+    free(threads);
+
+    printf("mode: %-6s threads: %3d time: %8.3f sec  rate: %10.3f Mops/sec\n",
+           mode_names[mode], ctx.thread_count, elapsed,
+           (ctx.iter_count * ctx.thread_count) / elapsed / 1e6);
+    return 0;
+}
@@ -615,6 +615,118 @@ UCS_TEST_SKIP_COND_F(malloc_hook, fork, "broken") {
     }
 }
 
+class malloc_hook_arenas : public malloc_hook {
+public:
+    malloc_hook_arenas() : m_unmapped_size(0), m_event(this)
+    {
+        pthread_barrier_init(&m_barrier, NULL, num_threads);
+    }
+
+    ~malloc_hook_arenas()
+    {
+        pthread_barrier_destroy(&m_barrier);
+    }
+
+    void mem_event(ucm_event_type_t event_type, ucm_event_t *event)
+    {
+        if (event_type == UCM_EVENT_VM_UNMAPPED) {
+            ucs_atomic_add64(&m_unmapped_size, event->vm_unmapped.size);
+        }
+    }
+
+    void test()
+    {
+        int index = ucs_atomic_fadd32(&m_thread_index, 1);
+        std::vector<char*> &ptrs = m_ptrs[index];
+        std::vector<char*> &peer_ptrs = m_ptrs[(index + 1) % num_threads];
+
+        /* Allocate blocks to be released by another thread */
+        for (int i = 0; i < num_blocks; ++i) {
+            size_t size = block_size(index, i);
+            char *ptr   = (char*)malloc(size);
+            memset(ptr, index, size);
+            ptrs.push_back(ptr);
+        }
+
+        pthread_barrier_wait(&m_barrier);
+
+        for (int i = 0; i < num_blocks; ++i) {
+            int peer_index = (index + 1) % num_threads;
+            size_t size    = block_size(peer_index, i);
+            char *ptr      = peer_ptrs[i];
+
+            EXPECT_EQ(peer_index, ptr[0]);
+            EXPECT_EQ(peer_index, ptr[size - 1]);
+            EXPECT_GE(malloc_usable_size(ptr), size);
+            if ((i % 2) == 0) {
+                /* Move the block to the current thread */
+                ptr = (char*)realloc(ptr, size * 2);
+                EXPECT_EQ(peer_index, ptr[size - 1]);
+            }
+            free(ptr);
+        }
+
+        pthread_barrier_wait(&m_barrier);
+
+        /* Reuse the blocks released by the other thread */
+        for (int i = 0; i < num_blocks; ++i) {
+            void *ptr = calloc(1, block_size(index, i));
+            ASSERT_TRUE(ptr != NULL);
+            free(ptr);
+        }
+    }
+
+protected:
+    static void *thread_func(void *arg)
+    {
+        reinterpret_cast<malloc_hook_arenas*>(arg)->test();
+        return NULL;
+    }
+
+    static const int num_threads = 4;
+    static const int num_blocks  = 1000;
+
+    static size_t block_size(int thread_index, int block_index)
+    {
+        return 16 + (((thread_index * num_blocks) + block_index) % 4096);
+    }
+
+    volatile uint64_t              m_unmapped_size;
+    volatile uint32_t              m_thread_index;
+    pthread_barrier_t              m_barrier;
+    std::vector<char*>             m_ptrs[num_threads];
+    mmap_event<malloc_hook_arenas> m_event;
+};
+
+UCS_TEST_SKIP_COND_F(malloc_hook_arenas, cross_thread_free,
+                     skip_on_bistro_without_valgrind()) {
+    static const size_t large_alloc_size = 40 * UCS_MBYTE;
+    unsigned malloc_arenas = ucm_global_opts.malloc_arenas;
+    pthread_t threads[num_threads];
+
+    ucm_global_opts.malloc_arenas = num_threads;
+    m_thread_index                = 0;
+
+    for (int i = 0; i < num_threads; ++i) {
+        pthread_create(&threads[i], NULL, thread_func, this);
+    }
+
+    for (int i = 0; i < num_threads; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    /* Large blocks still generate memory events when they are released */
+    ASSERT_UCS_OK(m_event.set(UCM_EVENT_VM_UNMAPPED));
+    void *ptr = malloc(large_alloc_size);
+    ASSERT_TRUE(ptr != NULL);
+    memset(ptr, 0, large_alloc_size);
+    free(ptr);
+    m_event.unset();
+    EXPECT_GE(m_unmapped_size, large_alloc_size);
+
+    ucm_global_opts.malloc_arenas = malloc_arenas;
+}
+
 class malloc_hook_cplusplus : public malloc_hook {
 public:
 
@@ -984,6 +984,31 @@ UCS_TEST_P(test_ucp_am_nbx, rx_am_mpools,
     ucp_am_data_release(receiver().worker(), rx_data);
 }
 
+UCS_TEST_P(test_ucp_am_nbx, multi_lane_congestion, "RNDV_THRESH=inf",
+           "MULTI_LANE_STEAL=y")
+{
+    static const unsigned num_msgs = 64;
+    size_t size                    = fragment_size() * 8;
+    std::vector<ucs_status_ptr_t> sreqs;
+
+    auto sbuf = mem_buffer::allocate(size, UCS_MEMORY_TYPE_HOST);
+    mem_buffer::pattern_fill(sbuf, size, SEED, UCS_MEMORY_TYPE_HOST);
+    set_am_data_handler(receiver(), TEST_AM_NBX_ID, am_data_cb, this);
+    reset_counters();
+
+    /* Post many multi-fragment messages at once to exhaust send resources of
+     * the lanes, so fragments are moved between lanes */
+    ucp::data_type_desc_t sdt_desc(m_dt, sbuf, size);
+    for (unsigned i = 0; i < num_msgs; ++i) {
+        sreqs.push_back(send_am(sdt_desc));
+    }
+
+    wait_receives();
+    requests_wait(sreqs);
+    EXPECT_EQ(m_recv_counter, m_send_counter);
+    mem_buffer::release(sbuf, UCS_MEMORY_TYPE_HOST);
+}
+
 UCP_INSTANTIATE_TEST_CASE(test_ucp_am_nbx)
 
 
@@ -1455,6 +1480,171 @@ UCS_TEST_P(test_ucp_am_nbx_eager_data_release, multi)
 
 UCP_INSTANTIATE_TEST_CASE(test_ucp_am_nbx_eager_data_release)
 
+class test_ucp_am_nbx_recv_pool : public test_ucp_am_nbx {
+public:
+    test_ucp_am_nbx_recv_pool()
+    {
+        modify_config("RNDV_THRESH", "inf");
+        m_hold      = false;
+        m_pool_get  = 0;
+        m_pool_put  = 0;
+        m_pool_data = NULL;
+    }
+
+    virtual void cleanup()
+    {
+        for (auto buffer : m_pool_buffers) {
+            free(buffer);
+        }
+        m_pool_buffers.clear();
+        test_ucp_am_nbx::cleanup();
+    }
+
+    virtual ucs_status_t
+    am_data_handler(const void *header, size_t header_length, void *data,
+                    size_t length, const ucp_am_recv_param_t *rx_param)
+    {
+        EXPECT_LT(m_recv_counter, m_send_counter);
+
+        check_header(header, header_length);
+        mem_buffer::pattern_check(data, length, SEED);
+        m_recv_counter++;
+
+        if (!(rx_param->recv_attr & UCP_AM_RECV_ATTR_FLAG_POOL)) {
+            return UCS_OK;
+        }
+
+        EXPECT_FALSE(rx_param->recv_attr & UCP_AM_RECV_ATTR_FLAG_DATA);
+
+        EXPECT_NE(m_pool_buffers.end(), m_pool_buffers.find(data));
+        if (!m_hold) {
+            return UCS_OK;
+        }
+
+        m_pool_data = data;
+        return UCS_INPROGRESS;
+    }
+
+    void set_recv_pool_handler(size_t min_length)
+    {
+        ucp_am_handler_param_t param;
+
+        param.field_mask           = UCP_AM_HANDLER_PARAM_FIELD_ID |
+                                     UCP_AM_HANDLER_PARAM_FIELD_CB |
+                                     UCP_AM_HANDLER_PARAM_FIELD_ARG |
+                                     UCP_AM_HANDLER_PARAM_FIELD_RECV_POOL;
+        param.id                   = TEST_AM_NBX_ID;
+        param.cb                   = am_data_cb;
+        param.arg                  = this;
+        param.recv_pool.get        = pool_get;
+        param.recv_pool.put        = pool_put;
+        param.recv_pool.arg        = this;
+        param.recv_pool.min_length = min_length;
+
+        ASSERT_UCS_OK(ucp_worker_set_am_recv_handler(receiver().worker(),
+                                                     &param));
+    }
+
+    void test_recv_pool(size_t size, bool hold, size_t min_length = 1)
+    {
+        auto sbuf        = mem_buffer::allocate(size, UCS_MEMORY_TYPE_HOST);
+        size_t exp_count = (size >= min_length) ? 1 : 0;
+
+        mem_buffer::pattern_fill(sbuf, size, SEED, UCS_MEMORY_TYPE_HOST);
+        m_hdr.resize(ucs_min(max_am_hdr(), 8));
+        ucs::fill_random(m_hdr);
+        reset_counters();
+        m_hold      = hold;
+        m_pool_get  = 0;
+        m_pool_put  = 0;
+        m_pool_data = NULL;
+
+        set_recv_pool_handler(min_length);
+
+        ucp::data_type_desc_t sdt_desc(m_dt, sbuf, size);
+        ucs_status_ptr_t sptr = send_am(sdt_desc, 0, m_hdr.data(),
+                                        m_hdr.size());
+        wait_receives();
+        request_wait(sptr);
+        mem_buffer::release(sbuf, UCS_MEMORY_TYPE_HOST);
+
+        EXPECT_EQ(exp_count, m_pool_get);
+        if (hold && (exp_count > 0)) {
+            EXPECT_EQ(0, m_pool_put);
+            ASSERT_NE((void*)NULL, m_pool_data);
+            pool_put(this, m_pool_data);
+        }
+        EXPECT_EQ(exp_count, m_pool_put);
+    }
+
+private:
+    static void *pool_get(void *arg, size_t length)
+    {
+        test_ucp_am_nbx_recv_pool *self =
+                reinterpret_cast<test_ucp_am_nbx_recv_pool*>(arg);
+        void *buffer = malloc(length);
+
+        self->m_pool_buffers.insert(buffer);
+        self->m_pool_get++;
+        return buffer;
+    }
+
+    static void pool_put(void *arg, void *buffer)
+    {
+        test_ucp_am_nbx_recv_pool *self =
+                reinterpret_cast<test_ucp_am_nbx_recv_pool*>(arg);
+
+        EXPECT_EQ(1, self->m_pool_buffers.erase(buffer));
+        free(buffer);
+        self->m_pool_put++;
+    }
+
+    bool            m_hold;
+    size_t          m_pool_get;
+    size_t          m_pool_put;
+    void            *m_pool_data;
+    std::set<void*> m_pool_buffers;
+};
+
+UCS_TEST_P(test_ucp_am_nbx_recv_pool, single)
+{
+    test_recv_pool(fragment_size() / 2, false);
+    test_recv_pool(fragment_size() / 2, true);
+}
+
+UCS_TEST_P(test_ucp_am_nbx_recv_pool, multi)
+{
+    test_recv_pool(fragment_size() * 4, false);
+    test_recv_pool(fragment_size() * 4, true);
+}
+
+UCS_TEST_P(test_ucp_am_nbx_recv_pool, min_length)
+{
+    size_t size = fragment_size() / 2;
+
+    test_recv_pool(size, false, size + 1);
+    test_recv_pool(size * 8, true, size + 1);
+}
+
+UCS_TEST_P(test_ucp_am_nbx_recv_pool, invalid_pool)
+{
+    ucp_am_handler_param_t param;
+
+    param.field_mask    = UCP_AM_HANDLER_PARAM_FIELD_ID |
+                          UCP_AM_HANDLER_PARAM_FIELD_CB |
+                          UCP_AM_HANDLER_PARAM_FIELD_RECV_POOL;
+    param.id            = TEST_AM_NBX_ID;
+    param.cb            = am_data_cb;
+    param.recv_pool.get = NULL;
+    param.recv_pool.put = NULL;
+
+    scoped_log_handler wrap_err(wrap_errors_logger);
+    EXPECT_EQ(UCS_ERR_INVALID_PARAM,
+              ucp_worker_set_am_recv_handler(receiver().worker(), &param));
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_am_nbx_recv_pool)
+
 class test_ucp_am_nbx_align : public test_ucp_am_nbx_reply {
 public:
     test_ucp_am_nbx_align()
@@ -1772,6 +1962,20 @@ UCS_TEST_P(test_ucp_am_nbx_rndv, rndv_put, "RNDV_SCHEME=put_zcopy")
     test_am_send_recv(64 * UCS_KBYTE);
 }
 
+UCS_TEST_P(test_ucp_am_nbx_rndv, rndv_get_reg_chunks, "RNDV_SCHEME=get_zcopy",
+           "RNDV_REG_CHUNK_SIZE=64k")
+{
+    check_rma_support();
+    test_am_send_recv(UCS_MBYTE + 1);
+}
+
+UCS_TEST_P(test_ucp_am_nbx_rndv, rndv_put_reg_chunks, "RNDV_SCHEME=put_zcopy",
+           "RNDV_REG_CHUNK_SIZE=64k")
+{
+    check_rma_support();
+    test_am_send_recv(UCS_MBYTE + 1);
+}
+
 UCS_TEST_P(test_ucp_am_nbx_rndv, rndv_flag_zero_send, "RNDV_THRESH=inf")
 {
     test_am_send_recv(0, 0, UCP_AM_SEND_FLAG_RNDV);
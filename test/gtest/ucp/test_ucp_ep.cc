@@ -5,7 +5,11 @@
  */
 
 #include "ucp_test.h"
+
+extern "C" {
 #include <ucp/core/ucp_context.h>
+#include <ucp/core/ucp_ep.h>
+}
 
 class test_ucp_ep : public ucp_test {
 public:
@@ -92,4 +96,15 @@ UCS_TEST_P(test_ucp_ep, ucp_query_transport)
     }
 }
 
+UCS_TEST_P(test_ucp_ep, feature_ext)
+{
+    ucp_ep_h ep = sender().ep();
+
+    /* Only tag matching is enabled, so no stream or AM state is allocated */
+    EXPECT_EQ(NULL, ep->ext->stream);
+    EXPECT_EQ(NULL, ep->ext->am);
+    EXPECT_LE(sizeof(ucp_ep_t) + sizeof(ucp_ep_ext_t),
+              ucp_ep_memory_usage(ep));
+}
+
 UCP_INSTANTIATE_TEST_CASE(test_ucp_ep);
@@ -1360,6 +1360,65 @@ UCS_TEST_P(test_ucp_rkey_compare, rkey_compare)
 UCP_INSTANTIATE_TEST_CASE_GPU_AWARE(test_ucp_rkey_compare)
 
 
+class test_ucp_rkey_cache : public test_ucp_mmap {
+protected:
+    static bool is_cached(ucp_rkey_h rkey)
+    {
+        return rkey->flags & UCP_RKEY_DESC_FLAG_CACHED;
+    }
+
+    unsigned cache_count()
+    {
+        return receiver().worker()->rkey_cache.count;
+    }
+};
+
+UCS_TEST_P(test_ucp_rkey_cache, shared_rkey, "RKEY_CACHE_SIZE=2")
+{
+    mem_chunk chunk(sender().ucph());
+
+    ucp_rkey_h rkey1 = chunk.unpack(receiver().ep());
+    ucp_rkey_h rkey2 = chunk.unpack(receiver().ep());
+    EXPECT_TRUE(is_cached(rkey1));
+    EXPECT_EQ(rkey1, rkey2);
+    EXPECT_EQ(1u, cache_count());
+
+    /* Unreferenced key stays in the cache and is returned again */
+    ucp_rkey_destroy(rkey1);
+    ucp_rkey_destroy(rkey2);
+    chunk.rkeys.clear();
+    EXPECT_EQ(rkey1, chunk.unpack(receiver().ep()));
+    EXPECT_EQ(1u, cache_count());
+}
+
+UCS_TEST_P(test_ucp_rkey_cache, evict, "RKEY_CACHE_SIZE=2")
+{
+    mem_chunk chunk1(sender().ucph()), chunk2(sender().ucph()),
+              chunk3(sender().ucph());
+
+    ucp_rkey_h rkey1 = chunk1.unpack(receiver().ep());
+    ucp_rkey_h rkey2 = chunk2.unpack(receiver().ep());
+    EXPECT_TRUE(is_cached(rkey1));
+    EXPECT_TRUE(is_cached(rkey2));
+    if (rkey1 == rkey2) {
+        UCS_TEST_SKIP_R("packed remote keys do not depend on the buffer");
+    }
+
+    /* All cached keys are referenced, so a private key is returned */
+    EXPECT_FALSE(is_cached(chunk3.unpack(receiver().ep())));
+    EXPECT_EQ(2u, cache_count());
+
+    /* Released key is evicted to make room for a new one */
+    ucp_rkey_destroy(rkey1);
+    chunk1.rkeys.clear();
+    EXPECT_TRUE(is_cached(chunk3.unpack(receiver().ep())));
+    EXPECT_EQ(2u, cache_count());
+    EXPECT_EQ(rkey2, chunk2.unpack(receiver().ep()));
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_rkey_cache)
+
+
 class test_ucp_mmap_export : public test_ucp_mmap {
 public:
     static void
@@ -2013,6 +2013,87 @@ UCS_TEST_SKIP_COND_P(test_ucp_sockaddr_check_lanes, check_rndv_lanes,
 UCP_INSTANTIATE_ALL_TEST_CASE(test_ucp_sockaddr_check_lanes)
 
 
+class test_ucp_sockaddr_ep_create_bulk : public test_ucp_sockaddr {
+public:
+    virtual ucp_ep_params_t get_ep_params()
+    {
+        ucp_ep_params_t params = test_ucp_sockaddr::get_ep_params();
+
+        params.err_handler.cb = err_handler_cb;
+        return params;
+    }
+
+    /* Every server endpoint gets a disconnect event during the teardown, so
+     * don't account the errors on the entity which expects at most one */
+    static void err_handler_cb(void *arg, ucp_ep_h ep, ucs_status_t status)
+    {
+        ++m_err_count;
+
+        switch (status) {
+        case UCS_ERR_UNREACHABLE:
+            ++m_unreachable_err_count;
+            /* Fallthrough */
+        case UCS_ERR_REJECTED:
+        case UCS_ERR_CONNECTION_RESET:
+        case UCS_ERR_NOT_CONNECTED:
+        case UCS_ERR_ENDPOINT_TIMEOUT:
+            UCS_TEST_MESSAGE << "ignoring error " << ucs_status_string(status)
+                             << " on endpoint " << ep;
+            return;
+        default:
+            UCS_TEST_ABORT("Error: " << ucs_status_string(status));
+        }
+    }
+
+protected:
+    static const int NUM_EPS;
+
+    void connect_bulk()
+    {
+        ucp_ep_params_t ep_params = get_ep_params();
+
+        ep_params.field_mask      |= UCP_EP_PARAM_FIELD_FLAGS |
+                                     UCP_EP_PARAM_FIELD_SOCK_ADDR |
+                                     UCP_EP_PARAM_FIELD_USER_DATA;
+        ep_params.flags           |= UCP_EP_PARAMS_FLAGS_CLIENT_SERVER;
+        ep_params.sockaddr.addr    = m_test_addr.get_sock_addr_ptr();
+        ep_params.sockaddr.addrlen = m_test_addr.get_addr_size();
+        ep_params.user_data        = &sender();
+
+        sender().connect_bulk(std::vector<ucp_ep_params_t>(NUM_EPS,
+                                                           ep_params));
+    }
+};
+
+const int test_ucp_sockaddr_ep_create_bulk::NUM_EPS = 8;
+
+UCS_TEST_P(test_ucp_sockaddr_ep_create_bulk, connect,
+           "TCP_CM_MAX_CONNECTING?=2")
+{
+    listen(cb_type());
+
+    {
+        scoped_log_handler slh(detect_error_logger);
+        connect_bulk();
+        wait_progress([this]() {
+            return (receiver().get_num_eps() == NUM_EPS) ||
+                   (m_err_count > 0);
+        });
+    }
+
+    if (m_err_count > 0) {
+        UCS_TEST_SKIP_R("cannot connect to server");
+    }
+
+    ASSERT_EQ(NUM_EPS, receiver().get_num_eps());
+    for (int i = 0; i < NUM_EPS; ++i) {
+        flush_ep(sender(), 0, i);
+    }
+}
+
+UCP_INSTANTIATE_ALL_TEST_CASE(test_ucp_sockaddr_ep_create_bulk)
+
+
 class test_ucp_sockaddr_destroy_ep_on_err : public test_ucp_sockaddr {
 public:
     test_ucp_sockaddr_destroy_ep_on_err() {
@@ -35,9 +35,13 @@ public:
     {
         return get_variant_value() == RECV_REQ_EXTERNAL;
     }
+
+protected:
+    void test_send_recv();
 };
 
-UCS_TEST_P(test_ucp_tag_mt, send_recv) {
+void test_ucp_tag_mt::test_send_recv()
+{
     const unsigned num_threads = mt_num_threads();
     uint64_t send_data[num_threads] GTEST_ATTRIBUTE_UNUSED_;
     uint64_t recv_data[num_threads] GTEST_ATTRIBUTE_UNUSED_;
@@ -74,4 +78,13 @@ UCS_TEST_P(test_ucp_tag_mt, send_recv) {
 #endif
 }
 
+UCS_TEST_P(test_ucp_tag_mt, send_recv) {
+    test_send_recv();
+}
+
+UCS_TEST_P(test_ucp_tag_mt, send_recv_progress_combining,
+           "MT_PROGRESS_COMBINING=y") {
+    test_send_recv();
+}
+
 UCP_INSTANTIATE_TEST_CASE(test_ucp_tag_mt)
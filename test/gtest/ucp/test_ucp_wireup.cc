@@ -482,6 +482,7 @@ UCS_TEST_P(test_ucp_wireup_1sided, address) {
     ASSERT_UCS_OK(status);
 
     EXPECT_EQ(sender().worker()->uuid, unpacked_address.uuid);
+    EXPECT_EQ(size, unpacked_address.length);
 #if ENABLE_DEBUG_DATA
     EXPECT_EQ(std::string(ucp_worker_get_address_name(sender().worker())),
               std::string(unpacked_address.name));
@@ -526,6 +527,7 @@ UCS_TEST_P(test_ucp_wireup_1sided, ep_address, "IB_NUM_PATHS?=2") {
     ASSERT_UCS_OK(status);
 
     EXPECT_EQ(sender().worker()->uuid, unpacked_address.uuid);
+    EXPECT_EQ(size, unpacked_address.length);
     EXPECT_LE(unpacked_address.address_count,
               static_cast<unsigned>(sender().ucph()->num_tls));
 
@@ -554,6 +556,7 @@ UCS_TEST_P(test_ucp_wireup_1sided, empty_address) {
     ASSERT_UCS_OK(status);
 
     EXPECT_EQ(sender().worker()->uuid, unpacked_address.uuid);
+    EXPECT_EQ(size, unpacked_address.length);
 #if ENABLE_DEBUG_DATA
     EXPECT_EQ(std::string(ucp_worker_get_address_name(sender().worker())),
               std::string(unpacked_address.name));
@@ -865,6 +868,36 @@ UCS_TEST_SKIP_COND_P(test_ucp_wireup_2sided, async_connect,
     requests_wait(reqs);
 }
 
+UCS_TEST_P(test_ucp_wireup_2sided, lazy_wireup, "LAZY_WIREUP=y") {
+    sender().connect(&receiver(), get_ep_params());
+    if (!is_loopback()) {
+        receiver().connect(&sender(), get_ep_params());
+
+        /* no lanes are selected before the first operation */
+        EXPECT_TRUE(sender().ep()->flags & UCP_EP_FLAG_LAZY_WIREUP);
+        EXPECT_TRUE(receiver().ep()->flags & UCP_EP_FLAG_LAZY_WIREUP);
+    }
+
+    send_recv(receiver().ep(), sender().worker(), sender().ep(), 1, 1);
+    flush_worker(receiver());
+    EXPECT_FALSE(receiver().ep()->flags & UCP_EP_FLAG_LAZY_WIREUP);
+
+    send_recv(sender().ep(), receiver().worker(), receiver().ep(), 1, 1);
+    flush_worker(sender());
+    EXPECT_FALSE(sender().ep()->flags & UCP_EP_FLAG_LAZY_WIREUP);
+}
+
+UCS_TEST_P(test_ucp_wireup_2sided, lazy_connect_disconnect, "LAZY_WIREUP=y") {
+    sender().connect(&receiver(), get_ep_params());
+    if (!is_loopback()) {
+        receiver().connect(&sender(), get_ep_params());
+    }
+    disconnect(sender());
+    if (!is_loopback()) {
+        disconnect(receiver());
+    }
+}
+
 UCS_TEST_P(test_ucp_wireup_2sided, connect_disconnect) {
     sender().connect(&receiver(), get_ep_params());
     if (!is_loopback()) {
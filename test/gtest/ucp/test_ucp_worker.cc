@@ -804,6 +804,93 @@ UCS_TEST_P(test_ucp_worker_address_query, query)
 
 UCP_INSTANTIATE_TEST_CASE(test_ucp_worker_address_query)
 
+class test_ucp_worker_address_compact : public ucp_test {
+public:
+    static void get_test_variants(std::vector<ucp_test_variant> &variants)
+    {
+        add_variant(variants, UCP_FEATURE_TAG);
+    }
+
+protected:
+    void query_address(uint32_t address_flags, ucp_worker_attr_t &attr)
+    {
+        attr.field_mask    = UCP_WORKER_ATTR_FIELD_ADDRESS |
+                             UCP_WORKER_ATTR_FIELD_ADDRESS_FLAGS;
+        attr.address_flags = address_flags;
+        if (address_flags & UCP_WORKER_ADDRESS_FLAG_COMPACT) {
+            attr.field_mask |= UCP_WORKER_ATTR_FIELD_ADDRESS_DICT;
+        }
+
+        ASSERT_UCS_OK(ucp_worker_query(receiver().worker(), &attr));
+    }
+
+    ucs_status_t create_ep(const ucp_address_t *address, ucp_ep_h *ep_p)
+    {
+        ucp_ep_params_t ep_params = get_ep_params();
+
+        ep_params.field_mask |= UCP_EP_PARAM_FIELD_REMOTE_ADDRESS;
+        ep_params.address     = address;
+        return ucp_ep_create(sender().worker(), &ep_params, ep_p);
+    }
+};
+
+UCS_TEST_P(test_ucp_worker_address_compact, connect)
+{
+    ucp_worker_attr_t full_attr = {}, attr = {};
+    ucs_status_t status;
+    ucp_ep_h ep;
+
+    query_address(0, full_attr);
+    query_address(UCP_WORKER_ADDRESS_FLAG_COMPACT, attr);
+    UCS_TEST_MESSAGE << "address length: full " << full_attr.address_length
+                     << ", compact " << attr.address_length
+                     << ", dictionary " << attr.address_dict_length;
+    EXPECT_LT(attr.address_length, full_attr.address_length);
+
+    ucp_worker_address_attr_t address_attr = {};
+    address_attr.field_mask = UCP_WORKER_ADDRESS_ATTR_FIELD_UID;
+    ASSERT_UCS_OK(ucp_worker_address_query(attr.address, &address_attr));
+    EXPECT_EQ(receiver().worker()->uuid, address_attr.worker_uid);
+
+    {
+        scoped_log_handler slh(hide_errors_logger);
+        status = create_ep(attr.address, &ep);
+    }
+    EXPECT_EQ(UCS_ERR_NO_ELEM, status);
+
+    /* Importing the same dictionary twice is allowed */
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_UCS_OK(ucp_worker_address_dict_import(sender().worker(),
+                                                     attr.address_dict,
+                                                     attr.address_dict_length));
+    }
+
+    status = create_ep(attr.address, &ep);
+    ucp_worker_release_address(receiver().worker(), attr.address);
+    ucp_worker_release_address(receiver().worker(), attr.address_dict);
+    ucp_worker_release_address(receiver().worker(), full_attr.address);
+    if (status == UCS_ERR_UNREACHABLE) {
+        UCS_TEST_SKIP_R("Unreachable");
+    }
+
+    ASSERT_UCS_OK(status);
+
+    uint64_t send_data = 0xdeadbeef, recv_data = 0;
+    ucp_request_param_t param;
+    param.op_attr_mask = 0;
+    void *rreq         = ucp_tag_recv_nbx(receiver().worker(), &recv_data,
+                                          sizeof(recv_data), 1, 0, &param);
+    void *sreq         = ucp_tag_send_nbx(ep, &send_data, sizeof(send_data),
+                                          1, &param);
+    ASSERT_UCS_OK(request_wait(sreq));
+    ASSERT_UCS_OK(request_wait(rreq));
+    EXPECT_EQ(send_data, recv_data);
+
+    ASSERT_UCS_OK(request_wait(ucp_ep_close_nbx(ep, &param)));
+}
+
+UCP_INSTANTIATE_TEST_CASE(test_ucp_worker_address_compact)
+
 class test_ucp_worker_address_version : public ucp_test {
 public:
     static void get_test_variants(std::vector<ucp_test_variant> &variants)
@@ -727,6 +727,23 @@ void ucp_test_base::entity::connect(const entity* other,
     }
 }
 
+void ucp_test_base::entity::connect_bulk(
+        const std::vector<ucp_ep_params_t> &ep_params, int worker_idx)
+{
+    std::vector<ucp_ep_h> eps(ep_params.size());
+    ucs_status_t status;
+
+    status = ucp_ep_create_bulk(worker(worker_idx), ep_params.data(),
+                                ep_params.size(), eps.data());
+    for (size_t i = 0; i < eps.size(); ++i) {
+        if (eps[i] != NULL) {
+            set_ep(eps[i], worker_idx, i);
+        }
+    }
+
+    ASSERT_UCS_OK(status);
+}
+
 /*
  * Checks if the client's address matches any IP address on the server's side.
  */
@@ -1040,7 +1057,7 @@ unsigned ucp_test_base::entity::progress(int worker_index)
 
     unsigned progress_count = 0;
     if (!m_conn_reqs.empty()) {
-        ucp_conn_request_h conn_req = m_conn_reqs.back();
+        ucp_conn_request_h conn_req = m_conn_reqs.front();
         m_conn_reqs.pop();
         accept(worker_index, conn_req);
         ++progress_count;
@@ -122,6 +122,61 @@ UCS_TEST_F(test_algorithm, crc32) {
     EXPECT_EQ(0xa684c7c6ul, ucs_crc32(0, test_str.c_str(), test_str.size()));
 }
 
+UCS_TEST_F(test_algorithm, crc32c) {
+    std::string test_str;
+
+    test_str = "";
+    EXPECT_EQ(0u, ucs_crc32c(0, test_str.c_str(), test_str.size()));
+
+    test_str = "123456789";
+    EXPECT_EQ(0xe3069283ul, ucs_crc32c(0, test_str.c_str(), test_str.size()));
+
+    /* iSCSI test vectors (RFC 3720) */
+    std::vector<uint8_t> buf(32, 0);
+    EXPECT_EQ(0x8a9136aaul, ucs_crc32c(0, &buf[0], buf.size()));
+
+    std::fill(buf.begin(), buf.end(), 0xff);
+    EXPECT_EQ(0x62a8ab43ul, ucs_crc32c(0, &buf[0], buf.size()));
+
+    for (size_t i = 0; i < buf.size(); ++i) {
+        buf[i] = i;
+    }
+    EXPECT_EQ(0x46dd794eul, ucs_crc32c(0, &buf[0], buf.size()));
+}
+
+UCS_TEST_F(test_algorithm, crc32c_split) {
+    /* Large enough to go through all interleaved block sizes */
+    std::vector<uint8_t> buf(100000 + 7);
+    for (size_t i = 0; i < buf.size(); ++i) {
+        buf[i] = ucs::rand();
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset) {
+        const uint8_t *p = &buf[offset];
+        size_t size      = buf.size() - offset;
+
+        /* Reference bitwise calculation */
+        uint32_t expected = ~0u;
+        for (size_t i = 0; i < size; ++i) {
+            expected ^= p[i];
+            for (int bit = 0; bit < 8; ++bit) {
+                expected = (expected >> 1) ^ (-(expected & 1) & 0x82f63b78u);
+            }
+        }
+        expected = ~expected;
+
+        EXPECT_EQ(expected, ucs_crc32c(0, p, size)) << "offset=" << offset;
+
+        for (int i = 0; i < 10; ++i) {
+            size_t split = ucs::rand() % size;
+            EXPECT_EQ(expected,
+                      ucs_crc32c(ucs_crc32c(0, p, split), p + split,
+                                 size - split))
+                    << "offset=" << offset << " split=" << split;
+        }
+    }
+}
+
 UCS_TEST_F(test_algorithm, string_distance) {
     // Empty strings
     EXPECT_EQ(0u, ucs_string_distance("", ""));
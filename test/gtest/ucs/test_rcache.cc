@@ -1058,6 +1058,49 @@ UCS_TEST_F(test_rcache_stats, hits_slow) {
 #endif
 
 
+class test_rcache_uffd : public test_rcache {
+protected:
+    virtual ucs_rcache_params_t rcache_params()
+    {
+        ucs_rcache_params_t params = test_rcache::rcache_params();
+        params.flags              |= UCS_RCACHE_FLAG_UFFD_EVENTS;
+        return params;
+    }
+
+    virtual void init()
+    {
+        test_rcache::init();
+        if (!(m_rcache->params.flags & UCS_RCACHE_FLAG_UFFD_EVENTS)) {
+            UCS_TEST_SKIP_R("userfaultfd is not supported");
+        }
+    }
+};
+
+UCS_TEST_F(test_rcache_uffd, unmap_dereg) {
+    static const size_t size = 1024 * 1024;
+    void *mem1               = alloc_pages(size, PROT_READ | PROT_WRITE);
+    void *mem2               = alloc_pages(size, PROT_READ | PROT_WRITE);
+    region *r;
+
+    /* Memory events are delivered by userfaultfd instead of UCM */
+    EXPECT_FALSE(m_rcache->params.ucm_events & UCM_EVENT_VM_UNMAPPED);
+
+    r = get(mem1, size);
+    put(r);
+    EXPECT_EQ(1u, m_reg_count);
+
+    /* Should generate unmap event and invalidate the region, which is
+     * deregistered by the next rcache operation */
+    munmap(mem1, size);
+
+    r = get(mem2, size);
+    EXPECT_EQ(1u, m_reg_count);
+    put(r);
+
+    munmap(mem2, size);
+}
+
+
 class test_rcache_pfn : public ucs::test {
 public:
     void test_pfn(void *address, unsigned page_num)
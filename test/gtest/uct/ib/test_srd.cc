@@ -834,4 +834,70 @@ UCS_TEST_P(test_srd, iface_fence_outstanding)
     pending_purge_check(0);
 }
 
+UCS_TEST_P(test_srd, cc_window, "SRD_CC=swift", "SRD_CC_TARGET_DELAY=1s",
+           "SRD_CC_AI=0.0001")
+{
+    uct_srd_ep_t *ep = ucs_derived_of(m_e1->ep(0), uct_srd_ep_t);
+    uint8_t c        = 23;
+    int i;
+
+    auto noop_func = [](void *arg, void *data, size_t length, unsigned flags) {
+        return UCS_OK;
+    };
+
+    ASSERT_UCS_OK(
+            uct_iface_set_am_handler(m_e2->iface(), 31, noop_func, NULL, 0));
+
+    ep->cc.cwnd = 4;
+    for (i = 0; i < 10; i++) {
+        if (uct_ep_am_short(m_e1->ep(0), 31, 0x1, &c, 1) != UCS_OK) {
+            break;
+        }
+    }
+
+    EXPECT_EQ(4, i);
+    EXPECT_EQ(4u, ep->inflight);
+
+    wait_for_value(&ep->inflight, 0u, true);
+    EXPECT_EQ(0u, ep->inflight);
+    EXPECT_GT(ep->cc.rtt, 0u);
+    ASSERT_UCS_OK(uct_ep_am_short(m_e1->ep(0), 31, 0x1, &c, 1));
+}
+
+UCS_TEST_P(test_srd, cc_pacing, "SRD_CC=swift", "SRD_CC_TARGET_DELAY=1s",
+           "SRD_CC_AI=0.0001")
+{
+    uct_srd_ep_t *ep = ucs_derived_of(m_e1->ep(0), uct_srd_ep_t);
+    uint8_t c        = 23;
+    int count        = 0;
+    bool paced       = false;
+    int i;
+
+    auto counter_func = [](void *arg, void *data, size_t length,
+                           unsigned flags) {
+        (*reinterpret_cast<int*>(arg))++;
+        return UCS_OK;
+    };
+
+    ASSERT_UCS_OK(uct_iface_set_am_handler(m_e2->iface(), 31, counter_func,
+                                           &count, 0));
+
+    ep->cc.cwnd = 0.5;
+    for (i = 0; i < 20;) {
+        if (uct_ep_am_short(m_e1->ep(0), 31, 0x1, &c, 1) != UCS_OK) {
+            paced = paced || ((ep->inflight == 0) &&
+                              uct_ud_cc_is_paced(&ep->cc, ucs_get_time()));
+            progress();
+            continue;
+        }
+
+        ++i;
+    }
+
+    wait_for_value(&count, 20, true);
+    EXPECT_EQ(20, count);
+    EXPECT_TRUE(paced);
+    EXPECT_LT(ep->cc.cwnd, 1.0);
+}
+
 UCT_INSTANTIATE_SRD_TEST_CASE(test_srd)
@@ -285,6 +285,306 @@ UCS_TEST_SKIP_COND_P(test_ud, flush_iface,
     validate_flush();
 }
 
+/* every 4th packet is dropped by the receiver: psn 4 is lost while psn 5 and
+ * 6 are kept out of order and selectively acked, so the hole is resent
+ * without waiting for the slow timer */
+UCS_TEST_SKIP_COND_P(test_ud, sack_fast_resend,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_RX_DROP_INTERVAL=4", "UD_TIMER_TICK=10s") {
+    unsigned i, N = 6;
+
+    disable_async(m_e1);
+    disable_async(m_e2);
+    connect();
+    set_tx_win(m_e1, 1024);
+    for (i = 0; i < N; i++) {
+        EXPECT_UCS_OK(tx(m_e1));
+    }
+
+    validate_recv(ep(m_e2), N, 1.0);
+    EXPECT_TRUE(ucs_frag_list_empty(&ep(m_e2)->rx.ooo_pkts));
+    EXPECT_UCS_OK(ep_flush_b(m_e1));
+}
+
+class test_ud_loss : public test_ud {
+public:
+    void send_recv(unsigned count) {
+        ucs_status_t status;
+        unsigned i;
+
+        connect();
+        for (i = 0; i < count;) {
+            status = tx(m_e1);
+            if (status == UCS_ERR_NO_RESOURCE) {
+                progress();
+                continue;
+            }
+
+            ASSERT_UCS_OK(status);
+            ++i;
+        }
+
+        validate_recv(ep(m_e2), count);
+        EXPECT_UCS_OK(ep_flush_b(m_e1));
+        EXPECT_TRUE(ucs_frag_list_empty(&ep(m_e2)->rx.ooo_pkts));
+    }
+};
+
+UCS_TEST_SKIP_COND_P(test_ud_loss, sack,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_RX_DROP_INTERVAL=7") {
+    send_recv(500);
+}
+
+UCS_TEST_SKIP_COND_P(test_ud_loss, go_back_n,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_RX_DROP_INTERVAL=7", "UD_SACK=n") {
+    send_recv(500);
+}
+
+UCT_INSTANTIATE_UD_TEST_CASE(test_ud_loss)
+
+class test_ud_cc : public test_ud_loss {
+};
+
+/* Any loss decreases the window of the delay-based algorithm */
+UCS_TEST_SKIP_COND_P(test_ud_cc, swift_loss,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_CC=swift", "UD_RX_DROP_INTERVAL=7") {
+    send_recv(500);
+    EXPECT_TRUE(ep(m_e1)->flags & UCT_UD_EP_FLAG_CC);
+    EXPECT_LT(ep(m_e1)->cc.cwnd, iface(m_e1)->config.cc.max_cwnd);
+    EXPECT_GT(ep(m_e1)->cc.rtt, 0u);
+    EXPECT_LE(ep(m_e1)->cc.min_rtt, ep(m_e1)->cc.rtt);
+}
+
+/* Window below one packet is enforced by pacing */
+UCS_TEST_SKIP_COND_P(test_ud_cc, swift_pacing,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_CC=swift", "UD_CC_TARGET_DELAY=1s",
+                     "UD_CC_AI=0.0001") {
+    unsigned i, count = 50;
+    bool paced        = false;
+    ucs_status_t status;
+
+    connect();
+    ep(m_e1)->cc.cwnd = 0.5;
+    set_tx_win(m_e1, 2);
+
+    for (i = 0; i < count;) {
+        status = tx(m_e1);
+        if (status == UCS_ERR_NO_RESOURCE) {
+            paced = paced || (ep(m_e1)->flags & UCT_UD_EP_FLAG_TX_PACED);
+            progress();
+            continue;
+        }
+
+        ASSERT_UCS_OK(status);
+        ++i;
+    }
+
+    validate_recv(ep(m_e2), count);
+    EXPECT_TRUE(paced);
+    EXPECT_LT(ep(m_e1)->cc.cwnd, 1.0);
+    EXPECT_GT(ep(m_e1)->cc.rtt, 0u);
+    EXPECT_UCS_OK(ep_flush_b(m_e1));
+}
+
+UCT_INSTANTIATE_UD_TEST_CASE(test_ud_cc)
+
+class test_ud_ack : public test_ud {
+public:
+    void wait_acked(entity *e, uct_ud_psn_t psn) {
+        uct_ud_ep_t *ud_ep = ep(e);
+
+        wait_for_cond([ud_ep, psn]() {
+                          return UCT_UD_PSN_COMPARE(ud_ep->tx.acked_psn, >=,
+                                                    psn);
+                      },
+                      [this]() { progress(); });
+        EXPECT_EQ(psn, ud_ep->tx.acked_psn);
+    }
+};
+
+/* Delayed ack is sent once the delay expires */
+UCS_TEST_SKIP_COND_P(test_ud_ack, delay_expire,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_ACK_DELAY=5ms") {
+    connect();
+    disable_async(m_e1);
+    disable_async(m_e2);
+    set_tx_win(m_e1, 2);
+
+    EXPECT_UCS_OK(tx(m_e1));
+    wait_acked(m_e1, 1);
+    EXPECT_EQ(0u, ep(m_e2)->rx.ack_time);
+    EXPECT_TRUE(ucs_list_is_empty(&iface(m_e2)->rx.ack_list));
+}
+
+/* Delayed ack is piggybacked on reverse data */
+UCS_TEST_SKIP_COND_P(test_ud_ack, delay_piggyback,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_TIMER_TICK=1s", "UD_ACK_DELAY=500ms") {
+    connect();
+    disable_async(m_e1);
+    disable_async(m_e2);
+    set_tx_win(m_e1, 2);
+
+    EXPECT_UCS_OK(tx(m_e1));
+    short_progress_loop();
+    EXPECT_NE(0u, ep(m_e2)->rx.ack_time);
+    EXPECT_EQ(0, ep(m_e1)->tx.acked_psn);
+
+    EXPECT_UCS_OK(tx(m_e2));
+    wait_acked(m_e1, 1);
+    short_progress_loop();
+    EXPECT_EQ(0u, ep(m_e2)->rx.ack_time);
+    EXPECT_TRUE(ucs_list_is_empty(&iface(m_e2)->rx.ack_list));
+}
+
+/* Delayed ack is sent once enough packets are not acknowledged */
+UCS_TEST_SKIP_COND_P(test_ud_ack, delay_coalesce,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT),
+                     "UD_TIMER_TICK=1s", "UD_ACK_DELAY=500ms",
+                     "UD_ACK_COALESCE=8") {
+    unsigned i, N = 16;
+
+    connect();
+    disable_async(m_e1);
+    disable_async(m_e2);
+    set_tx_win(m_e1, N);
+
+    /* ack is requested on 1/4 of the window */
+    for (i = 0; i < N / 4; i++) {
+        EXPECT_UCS_OK(tx(m_e1));
+    }
+    short_progress_loop();
+    EXPECT_NE(0u, ep(m_e2)->rx.ack_time);
+    EXPECT_EQ(0, ep(m_e1)->tx.acked_psn);
+
+    for (i = 0; i < N / 4; i++) {
+        EXPECT_UCS_OK(tx(m_e1));
+    }
+    wait_acked(m_e1, N / 2);
+    EXPECT_EQ(0u, ep(m_e2)->rx.ack_time);
+}
+
+UCT_INSTANTIATE_UD_TEST_CASE(test_ud_ack)
+
+
+class test_ud_rma : public test_ud {
+public:
+    static const uint64_t SEED1 = 0x1111111111111111lu;
+    static const uint64_t SEED2 = 0x2222222222222222lu;
+    static const uint64_t SEED3 = 0x3333333333333333lu;
+
+    static void rma_comp_cb(uct_completion_t *self)
+    {
+        EXPECT_UCS_OK(self->status);
+    }
+
+    void init() {
+        test_ud::init();
+        connect();
+        m_comp.func   = rma_comp_cb;
+        m_comp.count  = 1;
+        m_comp.status = UCS_OK;
+    }
+
+    size_t max_length() {
+        return ucs_min(m_e1->iface_attr().cap.put.max_zcopy,
+                       m_e1->iface_attr().cap.get.max_zcopy);
+    }
+
+    ucs_status_t put(const mapped_buffer &sendbuf,
+                     const mapped_buffer &recvbuf) {
+        UCS_TEST_GET_BUFFER_IOV(iov, iovcnt, sendbuf.ptr(), sendbuf.length(),
+                                sendbuf.memh(), 1);
+        return uct_ep_put_zcopy(m_e1->ep(0), iov, iovcnt, recvbuf.addr(),
+                                recvbuf.rkey(), &m_comp);
+    }
+
+    ucs_status_t get(const mapped_buffer &localbuf,
+                     const mapped_buffer &remotebuf) {
+        UCS_TEST_GET_BUFFER_IOV(iov, iovcnt, localbuf.ptr(),
+                                localbuf.length(), localbuf.memh(), 1);
+        return uct_ep_get_zcopy(m_e1->ep(0), iov, iovcnt, remotebuf.addr(),
+                                remotebuf.rkey(), &m_comp);
+    }
+
+    void wait_comp() {
+        wait_for_value(&m_comp.count, 0, true);
+        EXPECT_EQ(0, m_comp.count);
+        m_comp.count = 1;
+    }
+
+    void put_get(size_t length) {
+        mapped_buffer sendbuf(length, SEED1, *m_e1);
+        mapped_buffer remotebuf(length, SEED2, *m_e2);
+        mapped_buffer getbuf(length, SEED3, *m_e1);
+
+        ucs_status_t status = put(sendbuf, remotebuf);
+        ASSERT_EQ(UCS_INPROGRESS, status);
+        wait_comp();
+        remotebuf.pattern_check(SEED1);
+
+        status = get(getbuf, remotebuf);
+        ASSERT_EQ(UCS_INPROGRESS, status);
+        wait_comp();
+        getbuf.pattern_check(SEED1);
+    }
+
+protected:
+    uct_completion_t m_comp;
+};
+
+/* put and get are split to several segments */
+UCS_TEST_SKIP_COND_P(test_ud_rma, put_get_segments,
+                     !check_caps(UCT_IFACE_FLAG_PUT_ZCOPY |
+                                 UCT_IFACE_FLAG_GET_ZCOPY),
+                     "UD_RMA=y") {
+    size_t seg_len = uct_ud_iface_rma_seg_len(iface(m_e1));
+
+    EXPECT_EQ(seg_len * UCT_UD_RMA_MAX_SEGS, max_length());
+
+    put_get(seg_len);
+    put_get(seg_len + 1);
+    put_get(max_length());
+}
+
+/* lost segments of put and get responses are resent */
+UCS_TEST_SKIP_COND_P(test_ud_rma, put_get_loss,
+                     !check_caps(UCT_IFACE_FLAG_PUT_ZCOPY |
+                                 UCT_IFACE_FLAG_GET_ZCOPY),
+                     "UD_RMA=y", "UD_RX_DROP_INTERVAL=5") {
+    for (int i = 0; i < 4; ++i) {
+        put_get(max_length());
+    }
+}
+
+/* flush waits for an outstanding get */
+UCS_TEST_SKIP_COND_P(test_ud_rma, flush_get,
+                     !check_caps(UCT_IFACE_FLAG_GET_ZCOPY), "UD_RMA=y") {
+    mapped_buffer getbuf(max_length(), SEED1, *m_e1);
+    mapped_buffer remotebuf(max_length(), SEED2, *m_e2);
+
+    disable_async(m_e1);
+    disable_async(m_e2);
+
+    ucs_status_t status = get(getbuf, remotebuf);
+    ASSERT_EQ(UCS_INPROGRESS, status);
+    EXPECT_FALSE(ucs_queue_is_empty(&ep(m_e1)->tx.get_q));
+    EXPECT_EQ(UCS_ERR_NO_RESOURCE,
+              uct_ep_flush(m_e1->ep(0), 0, NULL));
+
+    wait_comp();
+    EXPECT_TRUE(ucs_queue_is_empty(&ep(m_e1)->tx.get_q));
+    flush();
+    getbuf.pattern_check(SEED2);
+}
+
+UCT_INSTANTIATE_UD_TEST_CASE(test_ud_rma)
+
 #if UCT_UD_EP_DEBUG_HOOKS
 
 /* disable ack req,
@@ -288,3 +288,86 @@ UCS_TEST_P(test_uct_tcp, check_addr_len)
 
 
 _UCT_INSTANTIATE_TEST_CASE(test_uct_tcp, tcp)
+
+
+class test_uct_tcp_pacing : public uct_test {
+public:
+    static const size_t MSG_SIZE = 1024;
+
+    test_uct_tcp_pacing() : m_sender(NULL), m_receiver(NULL), m_am_count(0)
+    {
+    }
+
+    void init()
+    {
+        uct_test::init();
+
+        m_sender = uct_test::create_entity(0);
+        m_entities.push_back(m_sender);
+        m_receiver = uct_test::create_entity(0);
+        m_entities.push_back(m_receiver);
+
+        m_sender->connect(0, *m_receiver, 0);
+        uct_iface_set_am_handler(m_receiver->iface(), 0, am_handler,
+                                 &m_am_count, 0);
+    }
+
+    static ucs_status_t
+    am_handler(void *arg, void *data, size_t length, unsigned flags)
+    {
+        ++(*reinterpret_cast<size_t*>(arg));
+        return UCS_OK;
+    }
+
+    /* Send the given amount of data and return the elapsed time in seconds */
+    double send_data(size_t total_size)
+    {
+        const size_t num_msgs = total_size / MSG_SIZE;
+        std::vector<char> buf(MSG_SIZE, 'x');
+        ucs_time_t start      = ucs_get_time();
+        ucs_status_t status;
+
+        for (size_t i = 0; i < num_msgs; ++i) {
+            do {
+                status = uct_ep_am_short(m_sender->ep(0), 0, 0, &buf[0],
+                                         buf.size());
+                if (status == UCS_ERR_NO_RESOURCE) {
+                    progress();
+                }
+            } while (status == UCS_ERR_NO_RESOURCE);
+            ASSERT_UCS_OK(status);
+        }
+
+        wait_for_value(&m_am_count, num_msgs, true);
+        EXPECT_EQ(num_msgs, m_am_count);
+
+        return ucs_time_to_sec(ucs_get_time() - start);
+    }
+
+protected:
+    entity *m_sender;
+    entity *m_receiver;
+    size_t m_am_count;
+};
+
+UCS_TEST_P(test_uct_tcp_pacing, ep_rate, "TCP_EP_PACING_RATE=20MBs",
+           "TCP_PACING_BURST=16kb")
+{
+    const size_t total_size = UCS_MBYTE * 4;
+    /* The first burst is sent without delay */
+    double min_time         = (double)(total_size - (16 * UCS_KBYTE)) /
+                              (20 * UCS_MBYTE);
+
+    EXPECT_GE(send_data(total_size), min_time * 0.9);
+}
+
+UCS_TEST_P(test_uct_tcp_pacing, iface_bandwidth, "TCP_PACING_RATE=100MBs")
+{
+    uct_iface_attr_t iface_attr;
+
+    ASSERT_UCS_OK(uct_iface_query(m_sender->iface(), &iface_attr));
+    EXPECT_LE(iface_attr.bandwidth.shared, 100.0 * UCS_MBYTE);
+    send_data(UCS_MBYTE);
+}
+
+_UCT_INSTANTIATE_TEST_CASE(test_uct_tcp_pacing, tcp)
@@ -926,3 +926,36 @@ UCS_TEST_SKIP_COND_P(uct_p2p_am_alignment, align_zcopy_with_offset,
 }
 
 UCT_INSTANTIATE_TEST_CASE(uct_p2p_am_alignment)
+
+class uct_p2p_am_checksum : public uct_p2p_am_test {
+};
+
+UCS_TEST_SKIP_COND_P(uct_p2p_am_checksum, am_short,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT), "TCP_CHECKSUM=y") {
+    test_xfer_multi(static_cast<send_func_t>(&uct_p2p_am_test::am_short),
+                    sizeof(uint64_t), sender().iface_attr().cap.am.max_short,
+                    TEST_UCT_FLAG_DIR_SEND_TO_RECV);
+}
+
+UCS_TEST_SKIP_COND_P(uct_p2p_am_checksum, am_short_iov,
+                     !check_caps(UCT_IFACE_FLAG_AM_SHORT), "TCP_CHECKSUM=y") {
+    test_xfer_multi(static_cast<send_func_t>(&uct_p2p_am_test::am_short_iov),
+                    sizeof(uint64_t), sender().iface_attr().cap.am.max_short,
+                    TEST_UCT_FLAG_DIR_SEND_TO_RECV);
+}
+
+UCS_TEST_SKIP_COND_P(uct_p2p_am_checksum, am_bcopy,
+                     !check_caps(UCT_IFACE_FLAG_AM_BCOPY), "TCP_CHECKSUM=y") {
+    test_xfer_multi(static_cast<send_func_t>(&uct_p2p_am_test::am_bcopy),
+                    0ul, sender().iface_attr().cap.am.max_bcopy,
+                    TEST_UCT_FLAG_DIR_SEND_TO_RECV);
+}
+
+UCS_TEST_SKIP_COND_P(uct_p2p_am_checksum, am_zcopy,
+                     !check_caps(UCT_IFACE_FLAG_AM_ZCOPY), "TCP_CHECKSUM=y") {
+    test_xfer_multi(static_cast<send_func_t>(&uct_p2p_am_test::am_zcopy),
+                    0ul, sender().iface_attr().cap.am.max_zcopy,
+                    TEST_UCT_FLAG_DIR_SEND_TO_RECV);
+}
+
+_UCT_INSTANTIATE_TEST_CASE(uct_p2p_am_checksum, tcp)
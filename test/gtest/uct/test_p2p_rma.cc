@@ -170,3 +170,16 @@ UCS_TEST_SKIP_COND_P(test_p2p_rma_madvise, madvise,
 }
 
 UCT_INSTANTIATE_TEST_CASE(test_p2p_rma_madvise)
+
+class uct_p2p_rma_checksum : public uct_p2p_rma_test {
+};
+
+UCS_TEST_SKIP_COND_P(uct_p2p_rma_checksum, put_zcopy,
+                     !check_caps(UCT_IFACE_FLAG_PUT_ZCOPY), "TCP_CHECKSUM=y") {
+    test_xfer_multi(static_cast<send_func_t>(&uct_p2p_rma_test::put_zcopy),
+                    sender().iface_attr().cap.put.min_zcopy,
+                    sender().iface_attr().cap.put.max_zcopy,
+                    TEST_UCT_FLAG_SEND_ZCOPY);
+}
+
+_UCT_INSTANTIATE_TEST_CASE(uct_p2p_rma_checksum, tcp)
@@ -742,6 +742,44 @@ protected:
         cm_disconnect(m_client);
     }
 
+    void test_many_conns_on_client() {
+        int num_conns_on_client = ucs_max(2, 100 /
+                                             ucs::test_time_multiplier());
+
+        m_server_start_disconnect = true;
+
+        /* Listen */
+        start_listen(conn_request_cb);
+
+        /* Connect */
+        /* multiple clients, on the same cm, connecting to the same server */
+        for (int i = 0; i < num_conns_on_client; ++i) {
+            connect(i);
+        }
+
+        /* wait for the server to connect to all the endpoints on the cm */
+        wait_for_client_server_counters(&m_server_connect_cb_cnt,
+                                        &m_client_connect_cb_cnt,
+                                        num_conns_on_client);
+
+        EXPECT_EQ(num_conns_on_client, m_server_recv_req_cnt);
+        EXPECT_EQ(num_conns_on_client, m_client_connect_cb_cnt);
+        EXPECT_EQ(num_conns_on_client, m_server_connect_cb_cnt);
+        EXPECT_EQ(num_conns_on_client, (int)m_client->num_eps());
+        EXPECT_EQ(num_conns_on_client, (int)m_server->num_eps());
+
+        /* Disconnect */
+        cm_disconnect(m_server);
+
+        /* wait for disconnect to complete */
+        wait_for_client_server_counters(&m_server_disconnect_cnt,
+                                        &m_client_disconnect_cnt,
+                                        num_conns_on_client);
+
+        EXPECT_EQ(num_conns_on_client, m_server_disconnect_cnt);
+        EXPECT_EQ(num_conns_on_client, m_client_disconnect_cnt);
+    }
+
     void add_user_data(client_user_data *user_data) {
         ucs::scoped_mutex_lock lock(m_ep_client_data_lock);
 
@@ -921,40 +959,14 @@ UCS_TEST_P(test_uct_sockaddr, cm_server_reject)
 
 UCS_TEST_P(test_uct_sockaddr, many_conns_on_client)
 {
-    int num_conns_on_client = ucs_max(2, 100 / ucs::test_time_multiplier());
-
-    m_server_start_disconnect = true;
-
-    /* Listen */
-    start_listen(conn_request_cb);
-
-    /* Connect */
-    /* multiple clients, on the same cm, connecting to the same server */
-    for (int i = 0; i < num_conns_on_client; ++i) {
-        connect(i);
-    }
-
-    /* wait for the server to connect to all the endpoints on the cm */
-    wait_for_client_server_counters(&m_server_connect_cb_cnt,
-                                    &m_client_connect_cb_cnt,
-                                    num_conns_on_client);
-
-    EXPECT_EQ(num_conns_on_client, m_server_recv_req_cnt);
-    EXPECT_EQ(num_conns_on_client, m_client_connect_cb_cnt);
-    EXPECT_EQ(num_conns_on_client, m_server_connect_cb_cnt);
-    EXPECT_EQ(num_conns_on_client, (int)m_client->num_eps());
-    EXPECT_EQ(num_conns_on_client, (int)m_server->num_eps());
-
-    /* Disconnect */
-    cm_disconnect(m_server);
-
-    /* wait for disconnect to complete */
-    wait_for_client_server_counters(&m_server_disconnect_cnt,
-                                    &m_client_disconnect_cnt,
-                                    num_conns_on_client);
+    test_many_conns_on_client();
+}
 
-    EXPECT_EQ(num_conns_on_client, m_server_disconnect_cnt);
-    EXPECT_EQ(num_conns_on_client, m_client_disconnect_cnt);
+/* client handshakes beyond the limit are queued and started one by one */
+UCS_TEST_P(test_uct_sockaddr, many_conns_on_client_max_connecting,
+           "MAX_CONNECTING?=1")
+{
+    test_many_conns_on_client();
 }
 
 UCS_TEST_P(test_uct_sockaddr, err_handle)